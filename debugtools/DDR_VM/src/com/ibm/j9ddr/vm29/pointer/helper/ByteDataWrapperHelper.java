@@ -55,9 +55,17 @@ public class ByteDataWrapperHelper {
 		}
 	}
 
-	// #define BDWLEN(bdw) J9SHR_READMEM((bdw)->dataLength)
+	// #define BDW_COMPRESSED_FLAG 0x80000000
+	private static final long BDW_COMPRESSED_FLAG = 0x80000000L;
+
+	// #define BDWLEN(bdw) (J9SHR_READMEM((bdw)->dataLength) & ~BDW_COMPRESSED_FLAG)
 	public static U32 BDWLEN(ByteDataWrapperPointer ptr) throws CorruptDataException {
-		return new U32(ptr.dataLength());
+		return new U32(ptr.dataLength().longValue() & ~BDW_COMPRESSED_FLAG);
+	}
+
+	// #define BDWISCOMPRESSED(bdw) (BDW_COMPRESSED_FLAG == (J9SHR_READMEM((bdw)->dataLength) & BDW_COMPRESSED_FLAG))
+	public static boolean BDWISCOMPRESSED(ByteDataWrapperPointer ptr) throws CorruptDataException {
+		return BDW_COMPRESSED_FLAG == (ptr.dataLength().longValue() & BDW_COMPRESSED_FLAG);
 	}
 
 	// #define BDWTYPE(bdw)  J9SHR_READMEM((bdw)->dataType)
@@ -91,8 +91,9 @@ ClassFileParser::parseClassFile(ROMClassCreationContext *context, UDATA *initial
 		_j9CfrClassFile = (J9CfrClassFile *)buffer;
 		buildResult = BuildResult(result);
 	} else if ( BCT_ERR_GENERIC_ERROR == result ) {
-		/* error structure filled in, located in buffer */
-		context->recordCFRError(buffer);
+		/* error structure filled in, located in buffer. The caller records it with
+		 * ROMClassCreationContext::recordCFRError(), as the parse may run outside of the class table mutex.
+		 */
 		Trc_BCU_createRomClassEndian_Error(result, I_32(ClassRead));
 		buildResult = ClassRead;
 	} else {
@@ -54,6 +54,7 @@
 
 static const UDATA INITIAL_CLASS_FILE_BUFFER_SIZE = 4096;
 static const UDATA INITIAL_BUFFER_MANAGER_SIZE = 32768 * 10;
+static const UDATA MAX_SPARE_CLASS_FILE_BUFFERS = 8;
 
 ROMClassBuilder::ROMClassBuilder(J9JavaVM *javaVM, J9PortLibrary *portLibrary, UDATA maxStringInternTableSize, U_8 * verifyExcludeAttribute, VerifyClassFunction verifyClassFunction) :
 	_javaVM(javaVM),
@@ -66,6 +67,8 @@ ROMClassBuilder::ROMClassBuilder(J9JavaVM *javaVM, J9PortLibrary *portLibrary, U
 	_bufferManagerBuffer(NULL),
 	_anonClassNameBuffer(NULL),
 	_anonClassNameBufferSize(0),
+	_spareClassFileBuffers(NULL),
+	_spareClassFileBufferCount(0),
 	_stringInternTable(javaVM, portLibrary, maxStringInternTableSize)
 {
 }
@@ -84,6 +87,11 @@ ROMClassBuilder::~ROMClassBuilder()
 	j9mem_free_memory(_classFileBuffer);
 	j9mem_free_memory(_bufferManagerBuffer);
 	j9mem_free_memory(_anonClassNameBuffer);
+	while (NULL != _spareClassFileBuffers) {
+		SpareClassFileBuffer *next = _spareClassFileBuffers->next;
+		j9mem_free_memory(_spareClassFileBuffers);
+		_spareClassFileBuffers = next;
+	}
 }
 
 ROMClassBuilder *
@@ -216,7 +224,14 @@ ROMClassBuilder::buildROMClass(ROMClassCreationContext *context)
 
 	context->recordParseClassFileStart();
 	ClassFileParser classFileParser(_portLibrary, _verifyClassFunction);
-	result = classFileParser.parseClassFile(context, &_classFileParserBufferSize, &_classFileBuffer);
+	if (canParseOutsideClassTableMutex(context)) {
+		result = parseOutsideClassTableMutex(&classFileParser, context);
+	} else {
+		result = classFileParser.parseClassFile(context, &_classFileParserBufferSize, &_classFileBuffer);
+	}
+	if (ClassRead == result) {
+		context->recordCFRError(_classFileBuffer);
+	}
 	context->recordParseClassFileEnd();
 
 	if ( OK == result ) {
@@ -249,6 +264,71 @@ ROMClassBuilder::buildROMClass(ROMClassCreationContext *context)
 	return result;
 }
 
+/*
+ * Parsing and the static structure checks are the bulk of the work for most
+ * classes and only depend on the class file bytes, so they are done without the
+ * class table mutex when the caller holds it. Verbose statistics are recorded into
+ * the shared J9DynamicLoadStats, so verbose loads keep parsing under the mutex.
+ */
+bool
+ROMClassBuilder::canParseOutsideClassTableMutex(ROMClassCreationContext *context)
+{
+	return (NULL != _javaVM)
+		&& (NULL != _javaVM->classTableMutex)
+		&& !context->isVerbose()
+		&& (0 != omrthread_monitor_owned_by_self(_javaVM->classTableMutex));
+}
+
+/*
+ * Parse the class file into a spare buffer with the class table mutex released.
+ * The class file bytes are not moved by the GC while the parse runs, as the
+ * current thread keeps its VM access. On return the mutex is held again and the
+ * parsed buffer has been exchanged with _classFileBuffer, so the translation
+ * phase and the error reporting in defineclass.c see the same state as when
+ * parsing under the mutex.
+ */
+BuildResult
+ROMClassBuilder::parseOutsideClassTableMutex(ClassFileParser *classFileParser, ROMClassCreationContext *context)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	omrthread_monitor_t classTableMutex = _javaVM->classTableMutex;
+	U_8 *buffer = NULL;
+	UDATA bufferSize = INITIAL_CLASS_FILE_BUFFER_SIZE;
+	BuildResult result = OK;
+
+	if (NULL != _spareClassFileBuffers) {
+		SpareClassFileBuffer *spare = _spareClassFileBuffers;
+		_spareClassFileBuffers = spare->next;
+		_spareClassFileBufferCount -= 1;
+		buffer = (U_8 *)spare;
+		bufferSize = spare->size;
+	}
+
+	omrthread_monitor_exit(classTableMutex);
+	result = classFileParser->parseClassFile(context, &bufferSize, &buffer);
+	omrthread_monitor_enter(classTableMutex);
+
+	if ((NULL != _javaVM->dynamicLoadBuffers) && (_javaVM->dynamicLoadBuffers->classFileError == _classFileBuffer)) {
+		/* A stale error must not refer to a buffer that another thread may now parse into. */
+		_javaVM->dynamicLoadBuffers->classFileError = NULL;
+	}
+	if (NULL != _classFileBuffer) {
+		if (MAX_SPARE_CLASS_FILE_BUFFERS > _spareClassFileBufferCount) {
+			SpareClassFileBuffer *spare = (SpareClassFileBuffer *)_classFileBuffer;
+			spare->next = _spareClassFileBuffers;
+			spare->size = _classFileParserBufferSize;
+			_spareClassFileBuffers = spare;
+			_spareClassFileBufferCount += 1;
+		} else {
+			j9mem_free_memory(_classFileBuffer);
+		}
+	}
+	_classFileBuffer = buffer;
+	_classFileParserBufferSize = (NULL == buffer) ? INITIAL_CLASS_FILE_BUFFER_SIZE : bufferSize;
+
+	return result;
+}
+
 #if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
 BuildResult
 ROMClassBuilder::injectInterfaces(ClassFileOracle *classFileOracle)
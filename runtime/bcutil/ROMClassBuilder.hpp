@@ -114,6 +114,16 @@ private:
 		UDATA rawClassDataSize;
 	};
 
+	/*
+	 * Header written at the start of an idle class file buffer, linking it
+	 * into the list of buffers available to threads parsing concurrently.
+	 */
+	struct SpareClassFileBuffer
+	{
+		SpareClassFileBuffer *next;
+		UDATA size;
+	};
+
 	/* NOTE: Be sure to update J9DbgROMClassBuilder in j9nonbuilder.h when changing the state variables below. */
 	J9JavaVM *_javaVM;
 	J9PortLibrary * _portLibrary;
@@ -125,11 +135,15 @@ private:
 	U_8 *_anonClassNameBuffer;
 	UDATA _anonClassNameBufferSize;
 	U_8 *_bufferManagerBuffer;
+	SpareClassFileBuffer *_spareClassFileBuffers;
+	UDATA _spareClassFileBufferCount;
 	StringInternTable _stringInternTable;
 #if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
 	InterfaceInjectionInfo _interfaceInjectionInfo;
 #endif /* J9VM_OPT_VALHALLA_VALUE_TYPES */
 
+	bool canParseOutsideClassTableMutex(ROMClassCreationContext *context);
+	BuildResult parseOutsideClassTableMutex(ClassFileParser *classFileParser, ROMClassCreationContext *context);
 	BuildResult handleAnonClassName(J9CfrClassFile *classfile, bool *isLambda, ROMClassCreationContext *context);
 #if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
 	BuildResult injectInterfaces(ClassFileOracle *classFileOracle);
@@ -304,6 +304,10 @@ reportROMClassLoadEvents(J9VMThread* vmThread, J9ROMClass* romClass, J9ClassLoad
 
 /*
  * Warning: sender must hold class table mutex before calling.
+ * The mutex is released while the class load hooks run and while the class file is
+ * parsed, so other threads may define classes concurrently. Publishing the class in
+ * the class table is done by internalCreateRAMClassFromROMClass, which rechecks for
+ * a class of the same name defined in the meantime.
  */
 UDATA
 internalLoadROMClass(J9VMThread * vmThread, J9LoadROMClassData *loadData, J9TranslationLocalBuffer *localBuffer)
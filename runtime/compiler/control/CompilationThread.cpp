@@ -6987,6 +6987,47 @@ TR::CompilationInfoPerThreadBase::findAotBodyInSCC(J9VMThread *vmThread, const J
       return NULL;
    }
 
+//------------------------------ isAOTBodyUpgrade --------------------------------
+// Returns true if the recompilation described by 'entry' should be performed as
+// a relocatable compilation whose body then replaces the AOT body that the shared
+// cache holds for this method. This is only done when the cached body was compiled
+// at a lower opt level (typically cold, because the opt level was downgraded during
+// startup) so that subsequent runs load the better body directly instead of
+// loading the cold one and recompiling it again.
+//---------------------------------------------------------------------------------
+bool
+TR::CompilationInfoPerThreadBase::isAOTBodyUpgrade(J9VMThread *vmThread, TR_MethodToBeCompiled *entry, J9Method *method)
+   {
+#if defined(J9VM_INTERP_AOT_RUNTIME_SUPPORT) && defined(J9VM_OPT_SHARED_CLASSES) && (defined(TR_HOST_X86) || defined(TR_HOST_POWER) || defined(TR_HOST_S390) || defined(TR_HOST_ARM) || defined(TR_HOST_ARM64))
+   static char *disableAOTBodyUpgrade = feGetEnv("TR_DisableAOTBodyUpgrade");
+   if (disableAOTBodyUpgrade || !entry->_oldStartPC)
+      return false;
+
+   // Only bodies that were loaded from the shared cache are upgraded
+   TR_PersistentJittedBodyInfo *oldBodyInfo = TR::Recompilation::getJittedBodyInfoFromPC(entry->_oldStartPC);
+   if (!oldBodyInfo || !oldBodyInfo->getIsAotedBody())
+      return false;
+
+   // Profiling and hot bodies are too specific to the current run to be shared
+   TR_OptimizationPlan *plan = entry->_optimizationPlan;
+   if (plan->insertInstrumentation() || plan->getOptLevel() > warm || plan->getOptLevel() <= oldBodyInfo->getHotness())
+      return false;
+
+   // Another JVM may have upgraded the cached body already
+   const void *aotCachedMethod = findAotBodyInSCC(vmThread, J9_ROM_METHOD_FROM_RAM_METHOD(method));
+   if (!aotCachedMethod)
+      return false;
+
+   const TR_AOTMethodHeader *aotMethodHeaderEntry = reinterpret_cast<const TR_AOTMethodHeader *>(reinterpret_cast<const J9JITDataCacheHeader *>(aotCachedMethod) + 1);
+   uint32_t cachedOptLevel = (aotMethodHeaderEntry->flags & TR_AOTMethodHeader_OptLevelMask) >> TR_AOTMethodHeader_OptLevelShift;
+
+   // Bodies stored without an opt level are never replaced
+   return (cachedOptLevel != 0) && (static_cast<int32_t>(cachedOptLevel) - 1 < static_cast<int32_t>(plan->getOptLevel()));
+#else
+   return false;
+#endif
+   }
+
 bool
 TR::CompilationInfoPerThreadBase::isMethodIneligibleForAot(J9Method *method)
    {
@@ -7373,6 +7414,7 @@ TR::CompilationInfoPerThreadBase::preCompilationTasks(J9VMThread * vmThread,
 
       // Determine if we need to perform an AOT compilation
       //
+      bool aotBodyUpgrade = false;
       if (entry->isOutOfProcessCompReq())
          {
          // Since all of the preliminary checks have already been done at the client,
@@ -7383,6 +7425,7 @@ TR::CompilationInfoPerThreadBase::preCompilationTasks(J9VMThread * vmThread,
       else
          {
          TR::IlGeneratorMethodDetails & details = entry->getMethodDetails();
+         aotBodyUpgrade = TR::CompilationInfo::isCompiled(method) && isAOTBodyUpgrade(vmThread, entry, method);
          eligibleForRelocatableCompile =
 
             // Shared Classes Enabled
@@ -7394,8 +7437,9 @@ TR::CompilationInfoPerThreadBase::preCompilationTasks(J9VMThread * vmThread,
             && !details.isMethodHandleThunk()
             && !entry->isDLTCompile()
 
-            // Only generate AOT compilations for first time compiles
-            && !TR::CompilationInfo::isCompiled(method)
+            // Only generate AOT compilations for first time compiles,
+            // or for upgrades of lower opt level bodies in the SCC
+            && (!TR::CompilationInfo::isCompiled(method) || aotBodyUpgrade)
 
             // If using a loadLimit/loadLimitFile, don't do an AOT compilation
             // for a method body that's already in the SCC
@@ -7449,8 +7493,10 @@ TR::CompilationInfoPerThreadBase::preCompilationTasks(J9VMThread * vmThread,
          else
             {
             // Heuristic: generate AOT only for downgraded compilations in the second run
+            // Also generate AOT for recompilations that upgrade the body stored in the SCC
             if ((!isSecondAOTRun && entry->_optimizationPlan->isOptLevelDowngraded()) ||
-                entry->getMethodDetails().isJitDumpAOTMethod())
+                entry->getMethodDetails().isJitDumpAOTMethod() ||
+                aotBodyUpgrade)
                {
                canDoRelocatableCompile = true;
                }
@@ -11529,6 +11575,15 @@ TR::CompilationInfo::storeAOTInSharedCache(
 
    if (safeToStore)
       {
+      // Record the opt level of the body so that a later run can decide whether
+      // to replace it with a body compiled at a higher opt level
+      TR_AOTMethodHeader *storedMethodHeader = const_cast<TR_AOTMethodHeader *>(reinterpret_cast<const TR_AOTMethodHeader *>(reinterpret_cast<const J9JITDataCacheHeader *>(dataStart) + 1));
+      storedMethodHeader->flags &= ~TR_AOTMethodHeader_OptLevelMask;
+      storedMethodHeader->flags |= ((uint32_t)(comp->getMethodHotness() + 1) << TR_AOTMethodHeader_OptLevelShift) & TR_AOTMethodHeader_OptLevelMask;
+
+      // A relocatable recompilation only happens when upgrading the body in the cache
+      UDATA forceReplace = (entry && entry->_oldStartPC) ? 1 : 0;
+
       const U_8 *metadataToStore = dataStart;
       const U_8 *codedataToStore = codeStart;
       int metadataToStoreSize = dataSize;
@@ -11627,7 +11682,7 @@ TR::CompilationInfo::storeAOTInSharedCache(
                metadataToStoreSize,
                (const U_8*)codedataToStore,
                codedataToStoreSize,
-               0));
+               forceReplace));
       switch(reinterpret_cast<uintptr_t>(storedCompiledMethod))
          {
          case J9SHR_RESOURCE_STORE_FULL:
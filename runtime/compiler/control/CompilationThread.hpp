@@ -180,6 +180,7 @@ class CompilationInfoPerThreadBase
                               TR_RelocationRuntime *reloRuntime);
    const void* findAotBodyInSCC(J9VMThread *vmThread, const J9ROMMethod *romMethod);
    bool isMethodIneligibleForAot(J9Method *method);
+   bool isAOTBodyUpgrade(J9VMThread *vmThread, TR_MethodToBeCompiled *entry, J9Method *method);
 
 #if defined(J9VM_OPT_SHARED_CLASSES) && defined(J9VM_INTERP_AOT_RUNTIME_SUPPORT)
    TR_MethodMetaData *installAotCachedMethod(
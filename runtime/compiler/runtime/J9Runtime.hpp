@@ -191,6 +191,10 @@ typedef struct TR_AOTMethodHeader {
 #define TR_AOTMethodHeader_IsNotCapableOfExceptionHook               0x00000100
 #define TR_AOTMethodHeader_UsesOSR                                   0x00000200
 
+/* Opt level (TR_Hotness + 1) the AOT body was compiled at; 0 means unknown */
+#define TR_AOTMethodHeader_OptLevelMask                              0x0000F000
+#define TR_AOTMethodHeader_OptLevelShift                             12
+
 
 
 
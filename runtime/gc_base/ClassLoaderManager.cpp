@@ -160,6 +160,7 @@ MM_ClassLoaderManager::flushUndeadSegments(MM_EnvironmentBase *env)
 	J9MemorySegment *walker = _firstUndeadSegment;
 	_firstUndeadSegment = NULL;
 	_undeadSegmentsTotalSize = 0;
+	_deferredFlushRequested = false;
 	omrthread_monitor_exit(_undeadSegmentListMonitor);
 	
 	while (NULL != walker) {
@@ -170,6 +171,44 @@ MM_ClassLoaderManager::flushUndeadSegments(MM_EnvironmentBase *env)
 	}
 }
 
+UDATA
+MM_ClassLoaderManager::flushDeferredUndeadSegments(J9VMThread *vmThread)
+{
+	UDATA bytesReleased = 0;
+
+	if (_deferredFlushRequested) {
+		J9InternalVMFunctions *vmFuncs = _javaVM->internalVMFunctions;
+		Trc_MM_FlushUndeadSegments_Entry(vmThread, "Deferred");
+		while (true) {
+			omrthread_monitor_enter(_undeadSegmentListMonitor);
+			J9MemorySegment *segment = _firstUndeadSegment;
+			if (NULL == segment) {
+				_deferredFlushRequested = false;
+			} else {
+				_firstUndeadSegment = segment->nextSegmentInClassLoader;
+				_undeadSegmentsTotalSize -= segment->size;
+			}
+			omrthread_monitor_exit(_undeadSegmentListMonitor);
+
+			if (NULL == segment) {
+				break;
+			}
+			/* VM access is held from unlinking to freeing, so no GC can observe the segment in between */
+			bytesReleased += segment->size;
+			vmFuncs->freeMemorySegment(_javaVM, segment, TRUE);
+
+			if (J9_ARE_ANY_BITS_SET(vmThread->publicFlags, J9_PUBLIC_FLAGS_HALT_THREAD_EXCLUSIVE)) {
+				/* let the pending exclusive request (most likely a GC) proceed */
+				vmFuncs->internalReleaseVMAccess(vmThread);
+				vmFuncs->internalAcquireVMAccess(vmThread);
+			}
+		}
+		Trc_MM_FlushUndeadSegments_Exit(vmThread);
+	}
+
+	return bytesReleased;
+}
+
 void
 MM_ClassLoaderManager::setLastUnloadNumOfClassLoaders() 
 {
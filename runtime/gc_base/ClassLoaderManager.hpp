@@ -54,6 +54,7 @@ private:
 	omrthread_monitor_t _undeadSegmentListMonitor;
 	J9MemorySegment *_firstUndeadSegment;
 	UDATA _undeadSegmentsTotalSize;
+	volatile bool _deferredFlushRequested; /**< true if the undead segments may be released by a mutator thread outside of a GC cycle */
 	UDATA _lastUnloadNumOfClassLoaders;  /**< number of class loaders last seen during a dynamic class unloading pass */
 	UDATA _lastUnloadNumOfAnonymousClasses; /**< number of anonymous classes last seen during a dynamic class unloading pass */
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
@@ -73,6 +74,7 @@ public:
 		,_undeadSegmentListMonitor(NULL)
 		,_firstUndeadSegment(NULL)
 		,_undeadSegmentsTotalSize(0)
+		,_deferredFlushRequested(false)
 		,_lastUnloadNumOfClassLoaders(0)
 		,_lastUnloadNumOfAnonymousClasses(0)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
@@ -97,6 +99,21 @@ public:
 	 * @param env The environment
 	 */
 	void flushUndeadSegments(MM_EnvironmentBase *env);
+
+	/**
+	 * Allow the cached list of segments to be flushed outside of a GC cycle by flushDeferredUndeadSegments.
+	 * Only collectors which never walk dead objects after class unloading (i.e. Balanced) may request this.
+	 */
+	void requestDeferredUndeadSegmentsFlush() { _deferredFlushRequested = true; }
+
+	/**
+	 * Flushes the cached list of segments from a mutator thread (the finalizer), if requested by the collector.
+	 * Segments are removed from the list one at a time so the list monitor is never held while memory is
+	 * released, and VM access is briefly released whenever another thread is requesting exclusive access.
+	 * @param vmThread[in] the current thread, which must hold VM access
+	 * @return the number of bytes released
+	 */
+	UDATA flushDeferredUndeadSegments(J9VMThread *vmThread);
 	
 	/**
 	 * Returns the total amount of memory (in bytes) which would be reclaimed if the buffer were to be flushed
@@ -109,6 +109,50 @@ GC_FinalizeListManager::tearDown()
 	}
 }
 
+void
+GC_FinalizeListManager::jobsAdded()
+{
+	UDATA jobCount = _classLoaderCount + _defaultFinalizableObjectCount + _systemFinalizableObjectCount + _referenceObjectCount;
+
+	if (jobCount > _peakJobCount) {
+		_peakJobCount = jobCount;
+	}
+	if ((0 == _backlogStartTime) && (0 != jobCount)) {
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		_backlogStartTime = omrtime_hires_clock();
+	}
+}
+
+void
+GC_FinalizeListManager::updateDrainTime()
+{
+	UDATA jobCount = _classLoaderCount + _defaultFinalizableObjectCount + _systemFinalizableObjectCount + _referenceObjectCount + _inFlightJobCount;
+
+	if ((0 == jobCount) && (0 != _backlogStartTime)) {
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		_lastDrainTime = omrtime_hires_delta(_backlogStartTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (_lastDrainTime > _maxDrainTime) {
+			_maxDrainTime = _lastDrainTime;
+		}
+		_backlogStartTime = 0;
+	}
+}
+
+UDATA
+GC_FinalizeListManager::reportQueueStats(U_64 *lastDrainTime, U_64 *maxDrainTime)
+{
+	lock();
+
+	UDATA peakJobCount = _peakJobCount;
+	*lastDrainTime = _lastDrainTime;
+	*maxDrainTime = _maxDrainTime;
+	_peakJobCount = _classLoaderCount + _defaultFinalizableObjectCount + _systemFinalizableObjectCount + _referenceObjectCount;
+
+	unlock();
+
+	return peakJobCount;
+}
+
 void
 GC_FinalizeListManager::addSystemFinalizableObjects(j9object_t head, j9object_t tail, UDATA objectCount)
 {
@@ -117,6 +161,7 @@ GC_FinalizeListManager::addSystemFinalizableObjects(j9object_t head, j9object_t
 	_extensions->accessBarrier->setFinalizeLink(tail, _systemFinalizableObjects);
 	_systemFinalizableObjects = head;
 	_systemFinalizableObjectCount += objectCount;
+	jobsAdded();
 
 	unlock();
 }
@@ -142,6 +187,7 @@ GC_FinalizeListManager::addDefaultFinalizableObjects(j9object_t head, j9object_t
 	_extensions->accessBarrier->setFinalizeLink(tail, _defaultFinalizableObjects);
 	_defaultFinalizableObjects = head;
 	_defaultFinalizableObjectCount += objectCount;
+	jobsAdded();
 
 	unlock();
 }
@@ -167,6 +213,7 @@ GC_FinalizeListManager::addReferenceObjects(j9object_t head, j9object_t tail, UD
 	_extensions->accessBarrier->setReferenceLink(tail, _referenceObjects);
 	_referenceObjects = head;
 	_referenceObjectCount += objectCount;
+	jobsAdded();
 
 	unlock();
 }
@@ -192,6 +239,7 @@ GC_FinalizeListManager::addClassLoaders(J9ClassLoader *head, J9ClassLoader *tail
 	tail->unloadLink = _classLoaders;
 	_classLoaders = head;
 	_classLoaderCount += count;
+	jobsAdded();
 
 	unlock();
 }
@@ -226,6 +274,7 @@ GC_FinalizeListManager::popRequiredClassLoaderForForcedClassLoaderUnload()
 
 			}
 			_classLoaderCount -= 1;
+			updateDrainTime();
 			break;
 		}
 		previousLoader = classLoader;
@@ -275,7 +324,7 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 	{
 		j9object_t systemObject = popSystemFinalizableObject();
 		if (NULL != systemObject) {
-			job->type = FINALIZE_JOB_TYPE_OBJECT;
+			job->type = FINALIZE_JOB_TYPE_SYSTEM_OBJECT;
 			job->object = systemObject;
 
 			return job;
@@ -285,4 +334,49 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 	return NULL;
 }
 
+UDATA
+GC_FinalizeListManager::consumeJobs(J9VMThread *vmThread, GC_FinalizeJob *jobs, UDATA maxJobs)
+{
+	UDATA jobCount = 0;
+
+	while ((jobCount < maxJobs) && (NULL != consumeJob(vmThread, &jobs[jobCount]))) {
+		jobCount += 1;
+	}
+	_inFlightJobCount += jobCount;
+
+	return jobCount;
+}
+
+void
+GC_FinalizeListManager::jobsCompleted(UDATA jobCount)
+{
+	Assert_MM_true(jobCount <= _inFlightJobCount);
+	_inFlightJobCount -= jobCount;
+	updateDrainTime();
+}
+
+void
+GC_FinalizeListManager::requeueJob(const GC_FinalizeJob *job)
+{
+	Assert_MM_true(0 != _inFlightJobCount);
+	_inFlightJobCount -= 1;
+
+	switch (job->type) {
+	case FINALIZE_JOB_TYPE_SYSTEM_OBJECT:
+		addSystemFinalizableObjects(job->object, job->object, 1);
+		break;
+	case FINALIZE_JOB_TYPE_OBJECT:
+		addDefaultFinalizableObjects(job->object, job->object, 1);
+		break;
+	case FINALIZE_JOB_TYPE_REFERENCE:
+		addReferenceObjects(job->reference, job->reference, 1);
+		break;
+	case FINALIZE_JOB_TYPE_CLASSLOADER:
+		addClassLoaders(job->classLoader, job->classLoader, 1);
+		break;
+	default:
+		Assert_MM_unreachable();
+	}
+}
+
 #endif /* J9VM_GC_FINALIZATION */
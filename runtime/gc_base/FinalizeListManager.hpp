@@ -45,7 +45,8 @@ class GC_CheckFinalizableList;
 typedef enum GC_FinalizeJobType {
 	FINALIZE_JOB_TYPE_OBJECT = 1,
 	FINALIZE_JOB_TYPE_REFERENCE = 2,
-	FINALIZE_JOB_TYPE_CLASSLOADER = 4
+	FINALIZE_JOB_TYPE_CLASSLOADER = 4,
+	FINALIZE_JOB_TYPE_SYSTEM_OBJECT = 9 /* FINALIZE_JOB_TYPE_OBJECT taken from the system finalizable list */
 } GC_FinalizeJobType;
 typedef struct GC_FinalizeJob {
 	GC_FinalizeJobType type;
@@ -75,11 +76,28 @@ private:
     UDATA _referenceObjectCount; /** count of the reference object */
     J9ClassLoader *_classLoaders; /**< head of the linked list of unloaded classloaders which have open native libraries  */
     UDATA _classLoaderCount; /** count of the class loaders */
+    UDATA _inFlightJobCount; /**< number of jobs consumed by the finalizer and not yet completed or requeued */
+    UDATA _peakJobCount; /**< highest number of queued jobs seen since the last reportQueueStats() */
+    U_64 _backlogStartTime; /**< hi-res time at which the first job of a backlog was queued, 0 while there is no backlog */
+    U_64 _lastDrainTime; /**< time in microseconds from the start of the most recent backlog until its last job completed */
+    U_64 _maxDrainTime; /**< longest time in microseconds taken to complete a backlog */
+    void *_activeBatch; /**< batch of jobs taken by a finalizer worker and not yet completed, see FinalizerSupport.cpp */
 protected:
 public:
     
 /* Methods */
 private:
+	/**
+	 * Update the queue depth statistics after jobs have been added.
+	 * @note Must be called while holding this class' _mutex
+	 */
+	void jobsAdded();
+	/**
+	 * Update the drain latency statistics after jobs have been completed or removed.
+	 * A backlog is drained once no job is queued or in flight.
+	 * @note Must be called while holding this class' _mutex
+	 */
+	void updateDrainTime();
 protected:
     /**
      * Pop the head of the System finalizable list
@@ -138,6 +156,28 @@ public:
 	MMINLINE UDATA getClassloaderCount() {return _classLoaderCount;}
 	MMINLINE UDATA getReferenceCount() {return _referenceObjectCount;}
 
+	/**
+	 * Report the queue statistics, and restart peak queue depth tracking from the current queue depth.
+	 * Acquires this class' _mutex.
+	 *
+	 * @param lastDrainTime[out] time in microseconds taken to complete the most recent backlog
+	 * @param maxDrainTime[out] longest time in microseconds taken to complete a backlog
+	 * @return the highest number of queued jobs since the previous report
+	 */
+	UDATA reportQueueStats(U_64 *lastDrainTime, U_64 *maxDrainTime);
+
+	/**
+	 * @note Must be called while holding this class' _mutex
+	 * @return the batch of jobs a finalizer worker is processing, or NULL
+	 */
+	MMINLINE void *getActiveBatch() {return _activeBatch;}
+	/**
+	 * Record the batch of jobs a finalizer worker is processing, so that a replacement
+	 * worker can reclaim its unprocessed jobs if the worker is abandoned.
+	 * @note Must be called while holding this class' _mutex
+	 */
+	MMINLINE void setActiveBatch(void *batch) {_activeBatch = batch;}
+
 	static GC_FinalizeListManager	*newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
 	bool initialize();
@@ -331,6 +371,38 @@ public:
 	 */
 	virtual GC_FinalizeJob *consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job);
 
+	/**
+	 * Pop up to maxJobs jobs, in the same priority order as consumeJob().
+	 * Taking a batch per lock acquisition keeps the worker from contending with the
+	 * collector on _mutex once per object when the lists are long.
+	 *
+	 * @note Must be called while holding this class' _mutex
+	 * @note The returned jobs hold direct object pointers; the caller must root them
+	 * before releasing VM access.
+	 *
+	 * @param jobs[out] array receiving the jobs
+	 * @param maxJobs[in] capacity of the jobs array
+	 * @return the number of jobs stored in jobs
+	 */
+	UDATA consumeJobs(J9VMThread *vmThread, GC_FinalizeJob *jobs, UDATA maxJobs);
+
+	/**
+	 * Record that jobs returned by consumeJobs() have been processed.
+	 * @note Must be called while holding this class' _mutex
+	 *
+	 * @param jobCount[in] the number of completed jobs
+	 */
+	void jobsCompleted(UDATA jobCount);
+
+	/**
+	 * Put back a job which was returned by consumeJobs() but not processed, so that a
+	 * subsequent worker will process it.
+	 * @note Must be called while holding this class' _mutex
+	 *
+	 * @param job[in] the job to return to its list
+	 */
+	void requeueJob(const GC_FinalizeJob *job);
+
 
 	/**
 	 * Create a FinalizeListManager object
@@ -346,6 +418,12 @@ public:
 	    ,_referenceObjectCount(0)
 	    ,_classLoaders(NULL)
 	    ,_classLoaderCount(0)
+	    ,_inFlightJobCount(0)
+	    ,_peakJobCount(0)
+	    ,_backlogStartTime(0)
+	    ,_lastDrainTime(0)
+	    ,_maxDrainTime(0)
+	    ,_activeBatch(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
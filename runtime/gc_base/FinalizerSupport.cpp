@@ -34,6 +34,7 @@
 
 #include "AtomicOperations.hpp"
 #include "ClassLoaderIterator.hpp"
+#include "ClassLoaderManager.hpp"
 #include "EnvironmentBase.hpp"
 #include "FinalizeListManager.hpp"
 #include "FinalizableObjectBuffer.hpp"
@@ -177,6 +178,24 @@ struct finalizeWorkerData {
 	IDATA wakeUp;
 };
 
+/*
+ * Jobs taken from the finalize lists in one go by a worker. The batch is allocated by its
+ * owning worker and freed when the worker exits. While the worker runs the batch, it is the
+ * active batch of the finalize list manager, and other threads only read it while holding
+ * the list lock. The objects of the jobs are kept in a Java Object[] rooted by a global
+ * reference, so any thread with VM access can read them.
+ * Jobs are claimed one at a time, so that if the worker is abandoned while it runs a job,
+ * the jobs it has not claimed can be put back on the finalize lists, either by the worker
+ * itself or by its replacement.
+ */
+struct finalizeBatch {
+	struct finalizeWorkerData *owner;
+	GC_FinalizeJob jobs[J9_FINALIZE_MAX_BATCH_SIZE];
+	jobjectArray jobObjects; /* global reference to the Object[] holding the object of each job, NULL if it could not be allocated */
+	UDATA jobCount;
+	volatile UDATA nextJob;
+};
+
 static int J9THREAD_PROC FinalizeWorkerThread(void *arg);
 IDATA FinalizeMainRunFinalization(J9JavaVM * vm, omrthread_t * indirectWorkerThreadHandle, struct finalizeWorkerData **indirectWorkerData, IDATA finalizeCycleLimit, IDATA mode);
 static int J9THREAD_PROC FinalizeMainThread(void *javaVM);
@@ -376,7 +395,7 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 }
 
 static void
-process_finalizable(J9VMThread *vmThread, j9object_t object, jclass j9VMInternalsClass, jmethodID runFinalizeMID)
+process_finalizable(J9VMThread *vmThread, jobject localRef, jclass j9VMInternalsClass, jmethodID runFinalizeMID)
 {
 	J9InternalVMFunctions* fns;
 	J9JavaVM *vm;
@@ -384,8 +403,6 @@ process_finalizable(J9VMThread *vmThread, j9object_t object, jclass j9VMInternal
 	vm = vmThread->javaVM;
 	fns = vm->internalVMFunctions;
 
-	jobject localRef = fns->j9jni_createLocalRef((JNIEnv *)vmThread, object);
-
 	fns->internalReleaseVMAccess(vmThread);
 
 	if((NULL != j9VMInternalsClass) && (NULL != runFinalizeMID)) {
@@ -399,13 +416,11 @@ process_finalizable(J9VMThread *vmThread, j9object_t object, jclass j9VMInternal
 		((JNIEnv *)vmThread)->ExceptionClear();
 	}
 
-	((JNIEnv *)vmThread)->DeleteLocalRef(localRef);
-
 	fns->internalEnterVMFromJNI(vmThread);
 }
 
 static void
-process_reference(J9VMThread *vmThread, j9object_t reference, jmethodID refMID)
+process_reference(J9VMThread *vmThread, jobject localRef, jmethodID refMID)
 {
 	J9InternalVMFunctions* fns;
 	J9JavaVM *vm;
@@ -413,8 +428,6 @@ process_reference(J9VMThread *vmThread, j9object_t reference, jmethodID refMID)
 	vm = vmThread->javaVM;
 	fns = vm->internalVMFunctions;
 
-	jobject localRef = fns->j9jni_createLocalRef((JNIEnv *)vmThread, reference);
-
 	fns->internalReleaseVMAccess(vmThread);
 
 	if (refMID) {
@@ -428,8 +441,6 @@ process_reference(J9VMThread *vmThread, j9object_t reference, jmethodID refMID)
 		((JNIEnv *)vmThread)->ExceptionClear();
 	}
 
-	((JNIEnv *)vmThread)->DeleteLocalRef(localRef);
-
 	fns->internalEnterVMFromJNI(vmThread);
 }
 
@@ -452,13 +463,87 @@ process_classloader(J9VMThread *vmThread, J9ClassLoader *classLoader)
 	fns->internalEnterVMFromJNI(vmThread);
 }
 
+/**
+ * Claim the next job of a batch.
+ * @return the index of the claimed job, or batch->jobCount if none are left
+ */
+static UDATA
+claimFinalizeJob(struct finalizeBatch *batch)
+{
+	UDATA jobIndex = batch->nextJob;
+
+	while (jobIndex < batch->jobCount) {
+		UDATA oldIndex = MM_AtomicOperations::lockCompareExchange(&batch->nextJob, jobIndex, jobIndex + 1);
+		if (oldIndex == jobIndex) {
+			break;
+		}
+		jobIndex = oldIndex;
+	}
+
+	return jobIndex;
+}
+
+/**
+ * Take the object of a claimed job out of the batch.
+ * @note The caller must have VM access
+ * @return the object, or NULL for a class loader job
+ */
+static j9object_t
+takeFinalizeJobObject(J9VMThread *vmThread, struct finalizeBatch *batch, UDATA jobIndex)
+{
+	j9object_t object = NULL;
+
+	if (FINALIZE_JOB_TYPE_CLASSLOADER != batch->jobs[jobIndex].type) {
+		if (NULL == batch->jobObjects) {
+			/* Without the array the batch holds a single job, which is taken before VM access is released */
+			Assert_MM_true(0 == jobIndex);
+			object = batch->jobs[jobIndex].object;
+		} else {
+			j9object_t jobObjects = J9_JNI_UNWRAP_REFERENCE(batch->jobObjects);
+			object = J9JAVAARRAYOFOBJECT_LOAD(vmThread, jobObjects, jobIndex);
+			J9JAVAARRAYOFOBJECT_STORE(vmThread, jobObjects, jobIndex, NULL);
+		}
+	}
+
+	return object;
+}
+
+/**
+ * Put the unclaimed jobs of a batch back on the finalize lists.
+ * @note The caller must have VM access and hold the finalize list lock
+ */
+static void
+requeueFinalizeBatch(J9VMThread *vmThread, GC_FinalizeListManager *finalizeListManager, struct finalizeBatch *batch)
+{
+	UDATA jobIndex = batch->nextJob;
+
+	while (jobIndex < batch->jobCount) {
+		UDATA oldIndex = MM_AtomicOperations::lockCompareExchange(&batch->nextJob, jobIndex, batch->jobCount);
+		if (oldIndex == jobIndex) {
+			break;
+		}
+		jobIndex = oldIndex;
+	}
+	for (; jobIndex < batch->jobCount; jobIndex++) {
+		GC_FinalizeJob *job = &batch->jobs[jobIndex];
+		if (FINALIZE_JOB_TYPE_CLASSLOADER != job->type) {
+			job->object = takeFinalizeJobObject(vmThread, batch, jobIndex);
+		}
+		finalizeListManager->requeueJob(job);
+	}
+}
+
+/**
+ * Process one job of a batch.
+ * @param localRef local reference rooting the job's object or reference (NULL for class loader jobs)
+ */
 static void
-process(J9VMThread *vmThread, const GC_FinalizeJob *finalizeJob, jclass j9VMInternalsClass, jmethodID runFinalizeMID, jmethodID referenceEnqueueImplMID)
+process(J9VMThread *vmThread, const GC_FinalizeJob *finalizeJob, jobject localRef, jclass j9VMInternalsClass, jmethodID runFinalizeMID, jmethodID referenceEnqueueImplMID)
 {
 	if (FINALIZE_JOB_TYPE_OBJECT == (finalizeJob->type & FINALIZE_JOB_TYPE_OBJECT)) {
-		process_finalizable(vmThread, finalizeJob->object, j9VMInternalsClass, runFinalizeMID);
+		process_finalizable(vmThread, localRef, j9VMInternalsClass, runFinalizeMID);
 	} else if (FINALIZE_JOB_TYPE_REFERENCE == (finalizeJob->type & FINALIZE_JOB_TYPE_REFERENCE)) {
-		process_reference(vmThread, finalizeJob->reference, referenceEnqueueImplMID);
+		process_reference(vmThread, localRef, referenceEnqueueImplMID);
 	} else if (FINALIZE_JOB_TYPE_CLASSLOADER == (finalizeJob->type & FINALIZE_JOB_TYPE_CLASSLOADER)) {
 		process_classloader(vmThread, finalizeJob->classLoader);
 	} else {
@@ -473,8 +558,9 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 {
 	struct finalizeWorkerData *workerData = (struct finalizeWorkerData *)arg;
 	J9VMThread *env;
-	const GC_FinalizeJob *finalizeJob;
-	GC_FinalizeJob localJob;
+	struct finalizeBatch *batch = NULL;
+	GC_FinalizeJob *jobs = NULL;
+	UDATA jobCount = 0;
 	jclass referenceClazz, j9VMInternalsClass = NULL;
 	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
 	J9InternalVMFunctions* fns;
@@ -483,14 +569,28 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 	J9JavaVM *vm = (J9JavaVM *)(workerData->vm);
 	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
 	MM_Forge *forge = extensions->getForge();
+	UDATA batchSize = extensions->finalizeBatchSize;
 
 	fns = vm->internalVMFunctions;
 	monitor = workerData->monitor;
 
 	finalizeListManager = extensions->finalizeListManager;
 
+	batch = (struct finalizeBatch *)forge->allocate(sizeof(struct finalizeBatch), MM_AllocationCategory::FINALIZE, J9_GET_CALLSITE());
+	if (NULL == batch) {
+		workerData->vmThread = (J9VMThread *)NULL;
+		omrthread_monitor_enter(monitor);
+		omrthread_monitor_notify_all(monitor);
+		omrthread_monitor_exit(monitor);
+		return 0;
+	}
+	batch->owner = workerData;
+	batch->jobObjects = NULL;
+	jobs = batch->jobs;
+
 	if (JNI_OK != vm->internalVMFunctions->attachSystemDaemonThread(vm, &env, "Finalizer thread")) {
 		/* Failed to attach the thread - very bad, most likely out of memory */
+		forge->free(batch);
 		workerData->vmThread = (J9VMThread *)NULL;
 		omrthread_monitor_enter(monitor);
 		omrthread_monitor_notify_all(monitor);
@@ -533,6 +633,22 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 			((JNIEnv *)env)->ExceptionClear();
 		}
 	}		
+
+	if (1 < batchSize) {
+		jclass objectClazz = ((JNIEnv *)env)->FindClass("java/lang/Object");
+		if (NULL != objectClazz) {
+			jobjectArray jobObjects = ((JNIEnv *)env)->NewObjectArray((jsize)batchSize, objectClazz, NULL);
+			if (NULL != jobObjects) {
+				batch->jobObjects = (jobjectArray)((JNIEnv *)env)->NewGlobalRef(jobObjects);
+			}
+		}
+		if (NULL == batch->jobObjects) {
+			/* Without somewhere to root the jobs, take them one at a time */
+			((JNIEnv *)env)->ExceptionClear();
+			batchSize = 1;
+		}
+		((JNIEnv *)env)->DeleteLocalRef(objectClazz);
+	}
 	workerData->vmThread = env;
 
 	/* Notify that the worker has come on line (We should check the result from above) */
@@ -554,6 +670,9 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 		fns->internalEnterVMFromJNI(env);
 		
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+		/* Release any class segments the collector has left for us (see MM_IncrementalGenerationalGC::unloadDeadClassLoaders) */
+		extensions->classLoaderManager->flushDeferredUndeadSegments(env);
+
 		if(workerData->mode != FINALIZE_WORKER_MODE_CL_UNLOAD)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 		{
@@ -569,11 +688,11 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 			if(workerData->mode == FINALIZE_WORKER_MODE_CL_UNLOAD) {
 				
-				if (NULL == (localJob.classLoader = (J9ClassLoader *)finalizeForcedClassLoaderUnload((J9VMThread *)env))) {
+				if (NULL == (jobs[0].classLoader = (J9ClassLoader *)finalizeForcedClassLoaderUnload((J9VMThread *)env))) {
 					break;
 				} else {
-					localJob.type = FINALIZE_JOB_TYPE_CLASSLOADER;
-					finalizeJob = &localJob;
+					jobs[0].type = FINALIZE_JOB_TYPE_CLASSLOADER;
+					jobCount = 1;
 				}
 
 			} else {
@@ -581,18 +700,26 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 
 
 				finalizeListManager->lock();
-				
-				finalizeJob = finalizeListManager->consumeJob(env, &localJob);
-				if(finalizeJob == NULL) {
+
+				/* If a previous worker was abandoned in the middle of a batch, put its remaining jobs back first */
+				struct finalizeBatch *abandonedBatch = (struct finalizeBatch *)finalizeListManager->getActiveBatch();
+				if (NULL != abandonedBatch) {
+					Assert_MM_true(workerData != abandonedBatch->owner);
+					requeueFinalizeBatch(env, finalizeListManager, abandonedBatch);
+					finalizeListManager->setActiveBatch(NULL);
+				}
+
+				jobCount = finalizeListManager->consumeJobs(env, jobs, batchSize);
+				if(0 == jobCount) {
 					if(workerData->mode == FINALIZE_WORKER_MODE_FORCED) {
 						finalizeForcedUnfinalizedToFinalizable(env);
-						finalizeJob = finalizeListManager->consumeJob(env, &localJob);
+						jobCount = finalizeListManager->consumeJobs(env, jobs, batchSize);
 					}
 				}
 
 				finalizeListManager->unlock();
 				
-				if(NULL != finalizeJob) {
+				if(0 != jobCount) {
 					workerData->noWorkDone = 0;
 				} else {
 					workerData->noWorkDone = 1;
@@ -603,27 +730,82 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 			}
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
-			/* processing will release/acquire VM access */
-			process(env, finalizeJob, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
+			/* The batch is no longer reachable from the finalize lists, so root every object in it
+			 * before the first job releases VM access.
+			 */
+			if (NULL != batch->jobObjects) {
+				j9object_t jobObjects = J9_JNI_UNWRAP_REFERENCE(batch->jobObjects);
+				for (UDATA i = 0; i < jobCount; i++) {
+					if (FINALIZE_JOB_TYPE_CLASSLOADER != jobs[i].type) {
+						J9JAVAARRAYOFOBJECT_STORE(env, jobObjects, i, jobs[i].object);
+					}
+				}
+			}
+			batch->jobCount = jobCount;
+			batch->nextJob = 0;
+			UDATA claimedJobCount = 0;
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+			/* A forced class loader unload job is not taken from the lists, so there is nothing to put back */
+			if (workerData->mode != FINALIZE_WORKER_MODE_CL_UNLOAD)
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+			{
+				finalizeListManager->lock();
+				finalizeListManager->setActiveBatch(batch);
+				finalizeListManager->unlock();
+			}
+
+			UDATA jobIndex = claimFinalizeJob(batch);
+			while (jobIndex < jobCount) {
+				claimedJobCount += 1;
+				j9object_t object = takeFinalizeJobObject(env, batch, jobIndex);
+				jobject localRef = (NULL == object) ? NULL : fns->j9jni_createLocalRef((JNIEnv *)env, object);
 
-			if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
-				omrthread_monitor_enter(vm->processReferenceMonitor);
-				if (0 == finalizeListManager->getReferenceCount()) {
-					/* There is no more pending reference. */
-					vm->processReferenceActive = 0;
+				/* processing will release/acquire VM access */
+				process(env, &jobs[jobIndex], localRef, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
+
+				if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
+					omrthread_monitor_enter(vm->processReferenceMonitor);
+					if ((batch->nextJob >= jobCount) && (0 == finalizeListManager->getReferenceCount())) {
+						/* There is no more pending reference, and none left in this batch. */
+						vm->processReferenceActive = 0;
+					}
+					/*
+					 * Notify any waiters that progress has been made.
+					 * This improves latency for Reference.waitForReferenceProcessing() and try to
+					 * avoid the performance issue if there are many of pending references in the queue.
+					 */
+					omrthread_monitor_notify_all(vm->processReferenceMonitor);
+					omrthread_monitor_exit(vm->processReferenceMonitor);
 				}
-				/*
-				 * Notify any waiters that progress has been made.
-				 * This improves latency for Reference.waitForReferenceProcessing() and try to
-				 * avoid the performance issue if there are many of pending references in the queue.
-				 */
-				omrthread_monitor_notify_all(vm->processReferenceMonitor);
-				omrthread_monitor_exit(vm->processReferenceMonitor);
+
+				if((FINALIZE_WORKER_SHOULD_ABANDON == workerData->die) || (FINALIZE_WORKER_ABANDONED == workerData->die)) {
+					/* Hand the rest of the batch back so that the replacement worker processes it */
+					finalizeListManager->lock();
+					requeueFinalizeBatch(env, finalizeListManager, batch);
+					finalizeListManager->unlock();
+					break;
+				}
+				jobIndex = claimFinalizeJob(batch);
+			}
+
+			/* If this worker was abandoned on timeout, its replacement may already have put the
+			 * unclaimed jobs back and cleared the active batch.
+			 */
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+			if (workerData->mode != FINALIZE_WORKER_MODE_CL_UNLOAD)
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+			{
+				finalizeListManager->lock();
+				if (batch == finalizeListManager->getActiveBatch()) {
+					finalizeListManager->setActiveBatch(NULL);
+				}
+				finalizeListManager->jobsCompleted(claimedJobCount);
+				finalizeListManager->unlock();
 			}
 
 			fns->jniResetStackReferences((JNIEnv *)env);
 
-			if(FINALIZE_WORKER_SHOULD_ABANDON == workerData->die) {
+			if((FINALIZE_WORKER_SHOULD_ABANDON == workerData->die) || (FINALIZE_WORKER_ABANDONED == workerData->die)) {
 				/* We've been abandoned, finish up */
 				break;
 			}
@@ -641,6 +823,10 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 	if (j9VMInternalsClass) {
 		((JNIEnv *)env)->DeleteGlobalRef(j9VMInternalsClass);
 	}
+	if (NULL != batch->jobObjects) {
+		((JNIEnv *)env)->DeleteGlobalRef(batch->jobObjects);
+	}
+	forge->free(batch);
 
 	((JavaVM *)vm)->DetachCurrentThread();
 
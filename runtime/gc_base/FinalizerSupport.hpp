@@ -42,4 +42,7 @@
 #define J9_FINALIZE_JOB_TYPE_FREE_CLASS_LOADER 2
 #define J9_FINALIZE_JOB_TYPE_REF_ENQUEUE 3
 
+/* upper bound for -Xgc:finalizeBatchSize (the size of the job array in the finalizer worker batch) */
+#define J9_FINALIZE_MAX_BATCH_SIZE 256
+
 #endif /* FINALIZERSUPPORT_HPP */
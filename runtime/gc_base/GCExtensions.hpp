@@ -98,6 +98,7 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 	IDATA finalizeCycleInterval;
 	IDATA finalizeCycleLimit;
+	UDATA finalizeBatchSize; /**< maximum number of jobs the finalizer worker takes from the finalize lists per lock acquisition */
 #endif /* J9VM_GC_FINALIZATION */
 
 	MM_HookInterface hookInterface;
@@ -154,6 +155,7 @@ public:
 	MM_ClassLoaderManager* classLoaderManager; /**< Pointer to the gc's classloader manager to process classloaders/classes */
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	UDATA deadClassLoaderCacheSize;
+	bool tarokEnableDeferredClassSegmentRelease; /**< if true, Balanced releases the RAM class segments of unloaded classes on the finalizer thread rather than in the unloading pause */
 #endif /*defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 
 
@@ -189,6 +191,9 @@ public:
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	MM_IdleGCManager* idleGCManager; /**< Manager which registers for VM Runtime State notification & manages free heap on notification */
+	bool heapTrimEnabled; /**< if true, free heap memory is periodically released while the memory usage of the process (or its cgroup) is above heapTrimPressureThreshold */
+	UDATA heapTrimInterval; /**< minimum time in milliseconds between two heap trims, also the period at which memory usage is sampled until heap trims stop releasing memory and back off */
+	UDATA heapTrimPressureThreshold; /**< memory usage, as a percentage of the cgroup limit (or physical memory), at or above which free heap memory is released */
 #endif
 
 	double maxRAMPercent; /**< Value of -XX:MaxRAMPercentage specified by the user */
@@ -294,6 +299,7 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 		, finalizeCycleInterval(J9_FINALIZABLE_INTERVAL)  /* 1/2 second */
 		, finalizeCycleLimit(0)  /* 0 seconds (i.e. no time limit) */
+		, finalizeBatchSize(32)
 #endif /* J9VM_GC_FINALIZATION */
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 		, dynamicClassUnloadingSet(false)
@@ -312,6 +318,7 @@ public:
 		, classLoaderManager(NULL)
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 		, deadClassLoaderCacheSize(1024 * 1024) /* default is one MiB */
+		, tarokEnableDeferredClassSegmentRelease(true)
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 		, unfinalizedObjectLists(NULL)
 		, objectListFragmentCount(0)
@@ -322,6 +329,9 @@ public:
 		, _HeapManagementMXBeanBackCompatibilityEnabled(false)
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, idleGCManager(NULL)
+		, heapTrimEnabled(false)
+		, heapTrimInterval(5000)
+		, heapTrimPressureThreshold(80)
 #endif
 		, maxRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, initialRAMPercent(0.0) /* this would get overwritten by user specified value */
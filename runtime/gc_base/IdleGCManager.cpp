@@ -34,6 +34,11 @@
 #include "OMRVMInterface.hpp"
 #include "Heap.hpp"
 
+/* largest multiple of heapTrimInterval the heap trim thread backs off to */
+#define HEAP_TRIM_MAXIMUM_BACKOFF 32
+/* a heap trim is worthwhile if it can release at least 1/HEAP_TRIM_MINIMUM_RELEASE_DIVISOR of the memory limit */
+#define HEAP_TRIM_MINIMUM_RELEASE_DIVISOR 100
+
 MM_IdleGCManager *
 MM_IdleGCManager::newInstance(MM_EnvironmentBase* env)
 {
@@ -61,6 +66,13 @@ MM_IdleGCManager::tearDown(MM_EnvironmentBase* env)
 	J9HookInterface** hookInterface = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
 	if (NULL != hookInterface) {
 		(*hookInterface)->J9HookUnregister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this);
+		(*hookInterface)->J9HookUnregister(hookInterface, J9HOOK_VM_INITIALIZED, idleGCManagerVMInitializedHook, this);
+		(*hookInterface)->J9HookUnregister(hookInterface, J9HOOK_VM_SHUTTING_DOWN, idleGCManagerVMShutdownHook, this);
+	}
+	if (NULL != _heapTrimMonitor) {
+		stopHeapTrimThread(NULL);
+		omrthread_monitor_destroy(_heapTrimMonitor);
+		_heapTrimMonitor = NULL;
 	}
 }
 
@@ -68,8 +80,23 @@ bool
 MM_IdleGCManager::initialize(MM_EnvironmentBase* env)
 {
 	J9HookInterface** hookInterface = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
-	if (NULL != hookInterface && (*hookInterface)->J9HookRegister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this)) {
-		return false;
+	/* idle GC and heap trimming are only supported for gencon, heap trimming has been filtered for the GC policy already */
+	_gcOnIdle = _extensions->gcOnIdle && (gc_policy_gencon == _extensions->configurationOptions._gcPolicy);
+	if (NULL != hookInterface) {
+		if (_gcOnIdle && (*hookInterface)->J9HookRegister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this)) {
+			return false;
+		}
+		if (_extensions->heapTrimEnabled) {
+			if (0 != omrthread_monitor_init_with_name(&_heapTrimMonitor, 0, "MM_IdleGCManager::heapTrim")) {
+				return false;
+			}
+			/* the trim thread needs a fully initialized VM to attach to */
+			if ((*hookInterface)->J9HookRegister(hookInterface, J9HOOK_VM_INITIALIZED, idleGCManagerVMInitializedHook, this)
+				|| (*hookInterface)->J9HookRegister(hookInterface, J9HOOK_VM_SHUTTING_DOWN, idleGCManagerVMShutdownHook, this)
+			) {
+				return false;
+			}
+		}
 	}
 	return true;
 }
@@ -85,6 +112,184 @@ MM_IdleGCManager::manageFreeHeap(J9VMThread* currentThread)
 	_javaVM->internalVMFunctions->internalReleaseVMAccess(currentThread);
 }
 
+bool
+MM_IdleGCManager::getMemoryUsage(U_64 *used, U_64 *limit)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_javaVM->omrVM);
+	J9MemoryInfo memInfo;
+
+	if (0 != omrsysinfo_get_memory_info(&memInfo)) {
+		return false;
+	}
+
+	U_64 cgroupLimit = 0;
+	if ((OMR_CGROUP_SUBSYSTEM_MEMORY == omrsysinfo_cgroup_are_subsystems_enabled(OMR_CGROUP_SUBSYSTEM_MEMORY))
+		&& omrsysinfo_cgroup_is_memlimit_set()
+		&& (0 == omrsysinfo_cgroup_get_memlimit(&cgroupLimit))
+	) {
+		/* with the memory subsystem enabled, total and available physical memory are those of the cgroup */
+		U_64 cgroupTotal = memInfo.totalPhysical;
+		U_64 cgroupAvail = memInfo.availPhysical;
+		if ((OMRPORT_MEMINFO_NOT_AVAILABLE == cgroupTotal) || (OMRPORT_MEMINFO_NOT_AVAILABLE == cgroupAvail) || (0 == cgroupLimit)) {
+			return false;
+		}
+		*limit = cgroupLimit;
+		*used = (cgroupTotal > cgroupAvail) ? (cgroupTotal - cgroupAvail) : 0;
+		return true;
+	}
+
+	/* no cgroup memory limit applies, the pressure is that of the host */
+	U_64 total = memInfo.hostTotalPhysical;
+	U_64 avail = memInfo.hostAvailPhysical;
+	if ((OMRPORT_MEMINFO_NOT_AVAILABLE == total) || (OMRPORT_MEMINFO_NOT_AVAILABLE == avail) || (0 == total)) {
+		return false;
+	}
+	*limit = total;
+	*used = (total > avail) ? (total - avail) : 0;
+	return true;
+}
+
+void
+MM_IdleGCManager::trimHeap(J9VMThread* currentThread)
+{
+	U_64 usedBefore = 0;
+	U_64 limit = 0;
+
+	if (!getMemoryUsage(&usedBefore, &limit) || ((usedBefore * 100) < (limit * _extensions->heapTrimPressureThreshold))) {
+		/* no memory pressure, sample again at the normal pace once it builds up */
+		_heapTrimBackoff = 1;
+		return;
+	}
+
+	U_64 minimumRelease = limit / HEAP_TRIM_MINIMUM_RELEASE_DIVISOR;
+	if ((U_64)_extensions->heap->getApproximateActiveFreeMemorySize() < minimumRelease) {
+		/* the heap is mostly in use, a collection could not release enough of it to relieve the pressure */
+		return;
+	}
+
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(currentThread->omrVMThread);
+
+	/* the idle collection releases the free pages of the heap; they are committed again on demand */
+	_javaVM->internalVMFunctions->internalAcquireVMAccess(currentThread);
+	_extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_EXPLICIT_GC_IDLE_GC);
+	_javaVM->internalVMFunctions->internalReleaseVMAccess(currentThread);
+
+	U_64 reclaimed = 0;
+	U_64 usedAfter = usedBefore;
+	if (getMemoryUsage(&usedAfter, &limit)) {
+		reclaimed = (usedBefore > usedAfter) ? (usedBefore - usedAfter) : 0;
+		_heapTrimLastReclaimedBytes = reclaimed;
+		_heapTrimReclaimedBytes += reclaimed;
+	}
+	_heapTrimCount += 1;
+
+	/* the pressure comes from outside the heap, back off rather than collecting back to back for nothing */
+	if (reclaimed < minimumRelease) {
+		_heapTrimBackoff = OMR_MIN(_heapTrimBackoff * 2, HEAP_TRIM_MAXIMUM_BACKOFF);
+	} else {
+		_heapTrimBackoff = 1;
+	}
+}
+
+void
+MM_IdleGCManager::heapTrimThreadMain()
+{
+	J9VMThread* vmThread = NULL;
+	bool attached = (JNI_OK == _javaVM->internalVMFunctions->attachSystemDaemonThread(_javaVM, &vmThread, "GC Heap Trim"));
+
+	omrthread_monitor_enter(_heapTrimMonitor);
+	if (!attached) {
+		_heapTrimThreadState = HEAP_TRIM_THREAD_STOPPING;
+	}
+	while (HEAP_TRIM_THREAD_RUNNING == _heapTrimThreadState) {
+		/* the wait paces memory usage sampling, and bounds the rate of heap trims */
+		omrthread_monitor_wait_timed(_heapTrimMonitor, _extensions->heapTrimInterval * _heapTrimBackoff, 0);
+		if (HEAP_TRIM_THREAD_RUNNING == _heapTrimThreadState) {
+			omrthread_monitor_exit(_heapTrimMonitor);
+			trimHeap(vmThread);
+			omrthread_monitor_enter(_heapTrimMonitor);
+		}
+	}
+	omrthread_monitor_exit(_heapTrimMonitor);
+
+	if (attached) {
+		((JavaVM *)_javaVM)->DetachCurrentThread();
+	}
+
+	omrthread_monitor_enter(_heapTrimMonitor);
+	_heapTrimThreadState = HEAP_TRIM_THREAD_TERMINATED;
+	omrthread_monitor_notify_all(_heapTrimMonitor);
+	omrthread_exit(_heapTrimMonitor);
+
+	/* NO GUARANTEED EXECUTION BEYOND THIS POINT */
+}
+
+int J9THREAD_PROC
+MM_IdleGCManager::heapTrimThreadProc(void *arg)
+{
+	((MM_IdleGCManager *)arg)->heapTrimThreadMain();
+	return 0;
+}
+
+void
+MM_IdleGCManager::startHeapTrimThread()
+{
+	omrthread_monitor_enter(_heapTrimMonitor);
+	if (HEAP_TRIM_THREAD_NOT_STARTED == _heapTrimThreadState) {
+		_heapTrimThreadState = HEAP_TRIM_THREAD_RUNNING;
+		if (0 != _javaVM->internalVMFunctions->createThreadWithCategory(
+				NULL,
+				_javaVM->defaultOSStackSize,
+				J9THREAD_PRIORITY_NORMAL,
+				0,
+				heapTrimThreadProc,
+				this,
+				J9THREAD_CATEGORY_SYSTEM_GC_THREAD)
+		) {
+			/* heap trimming is best effort, carry on without it */
+			_heapTrimThreadState = HEAP_TRIM_THREAD_TERMINATED;
+		}
+	}
+	omrthread_monitor_exit(_heapTrimMonitor);
+}
+
+void
+MM_IdleGCManager::stopHeapTrimThread(J9VMThread* currentThread)
+{
+	/* a trim in progress needs exclusive VM access, so do not hold VM access while waiting for it */
+	bool hadVMAccess = (NULL != currentThread) && J9_ARE_ANY_BITS_SET(currentThread->publicFlags, J9_PUBLIC_FLAGS_VM_ACCESS);
+	if (hadVMAccess) {
+		_javaVM->internalVMFunctions->internalReleaseVMAccess(currentThread);
+	}
+
+	omrthread_monitor_enter(_heapTrimMonitor);
+	if (HEAP_TRIM_THREAD_NOT_STARTED == _heapTrimThreadState) {
+		_heapTrimThreadState = HEAP_TRIM_THREAD_TERMINATED;
+	} else if (HEAP_TRIM_THREAD_TERMINATED != _heapTrimThreadState) {
+		_heapTrimThreadState = HEAP_TRIM_THREAD_STOPPING;
+		omrthread_monitor_notify_all(_heapTrimMonitor);
+		while (HEAP_TRIM_THREAD_TERMINATED != _heapTrimThreadState) {
+			omrthread_monitor_wait(_heapTrimMonitor);
+		}
+	}
+	omrthread_monitor_exit(_heapTrimMonitor);
+
+	if (hadVMAccess) {
+		_javaVM->internalVMFunctions->internalAcquireVMAccess(currentThread);
+	}
+}
+
+U_64
+MM_IdleGCManager::reportHeapTrimStats(U_64 *totalReclaimedBytes, U_64 *lastReclaimedBytes)
+{
+	U_64 count = _heapTrimCount;
+	U_64 newTrims = count - _heapTrimReportedCount;
+	_heapTrimReportedCount = count;
+	*totalReclaimedBytes = _heapTrimReclaimedBytes;
+	*lastReclaimedBytes = _heapTrimLastReclaimedBytes;
+	return newTrims;
+}
+
 extern "C" {
 void idleGCManagerVMStateHook(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
 {
@@ -96,5 +301,20 @@ void idleGCManagerVMStateHook(J9HookInterface** hook, uintptr_t eventNum, void*
 		idleMgr->manageFreeHeap(j9VMState->vmThread);
 	}
 }
+
+void idleGCManagerVMInitializedHook(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_IdleGCManager* idleMgr = (MM_IdleGCManager*)userData;
+
+	idleMgr->startHeapTrimThread();
+}
+
+void idleGCManagerVMShutdownHook(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	J9VMShutdownEvent* event = (J9VMShutdownEvent*)eventData;
+	MM_IdleGCManager* idleMgr = (MM_IdleGCManager*)userData;
+
+	idleMgr->stopHeapTrimThread(event->vmThread);
+}
 } /*end extern "C"  */
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
@@ -40,10 +40,22 @@ extern "C" {
  * Manages Heap Free Pages If Current Runtime State is IDLE
  */
 void idleGCManagerVMStateHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+/**
+ * Hook "J9HOOK_VM_INITIALIZED" callback function
+ * Starts the heap trim thread
+ */
+void idleGCManagerVMInitializedHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+/**
+ * Hook "J9HOOK_VM_SHUTTING_DOWN" callback function
+ * Stops the heap trim thread
+ */
+void idleGCManagerVMShutdownHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 }
 
 /**
- * Manages free java heap memory whenever JVM becomes idle. Registers for VM Runtime State Notification Hook
+ * Manages free java heap memory whenever JVM becomes idle. Registers for VM Runtime State Notification Hook.
+ * If heap trimming is enabled, also releases free heap memory periodically while the memory usage of the process
+ * (or of its cgroup, when a memory limit is set) is high, from a dedicated daemon thread.
  */
 class MM_IdleGCManager : public MM_BaseNonVirtual
 {
@@ -52,11 +64,47 @@ private:
 	 * reference to the language runtime
 	 */
 	J9JavaVM* _javaVM;
+	MM_GCExtensions* _extensions;
+	bool _gcOnIdle; /**< true if the manager handles the ACTIVE -> IDLE runtime state transition */
+
+	/* Heap trim thread states */
+	enum {
+		HEAP_TRIM_THREAD_NOT_STARTED = 0,
+		HEAP_TRIM_THREAD_RUNNING,
+		HEAP_TRIM_THREAD_STOPPING,
+		HEAP_TRIM_THREAD_TERMINATED
+	};
+	omrthread_monitor_t _heapTrimMonitor; /**< protects _heapTrimThreadState, and paces the heap trim thread */
+	volatile UDATA _heapTrimThreadState;
+	volatile U_64 _heapTrimCount; /**< number of heap trims performed */
+	volatile U_64 _heapTrimReclaimedBytes; /**< memory usage reduction accumulated over all heap trims */
+	volatile U_64 _heapTrimLastReclaimedBytes; /**< memory usage reduction of the most recent heap trim */
+	U_64 _heapTrimReportedCount; /**< value of _heapTrimCount at the time of the previous report */
+	UDATA _heapTrimBackoff; /**< multiplier of heapTrimInterval, doubled after each heap trim which did not release enough memory */
 
 protected:
 public:
 
 private:
+	/**
+	 * Sample the memory usage, against the cgroup memory limit if one is set, or else against the physical memory of the host.
+	 * @param[out] used memory in use, in bytes
+	 * @param[out] limit memory available to the process, in bytes
+	 * @return true if the memory usage could be determined
+	 */
+	bool getMemoryUsage(U_64 *used, U_64 *limit);
+	/**
+	 * Release free heap memory if the memory usage is at or above the heap trim pressure threshold
+	 * and enough of the heap is free, and account for the memory usage reduction.
+	 * The heap trim interval is backed off while heap trims do not release enough memory.
+	 */
+	void trimHeap(J9VMThread* currentThread);
+	/**
+	 * Body of the heap trim thread: attach, then trim the heap every heapTrimInterval, or a backed off multiple of it, until stopped.
+	 */
+	void heapTrimThreadMain();
+	static int J9THREAD_PROC heapTrimThreadProc(void *arg);
+
 protected:
 	/**
 	 * Initialize the object of this class and registers for Runtime State hook
@@ -80,12 +128,39 @@ public:
 	  */
 	void manageFreeHeap(J9VMThread* currentThread);
 
+	/**
+	 * Start the heap trim thread, once the VM is initialized
+	 */
+	void startHeapTrimThread();
+	/**
+	 * Stop the heap trim thread and wait for it to terminate
+	 * @param currentThread the calling thread, or NULL if it is not attached
+	 */
+	void stopHeapTrimThread(J9VMThread* currentThread);
+
+	/**
+	 * Return the heap trim statistics accumulated since startup
+	 * @param[out] totalReclaimedBytes memory usage reduction accumulated over all heap trims
+	 * @param[out] lastReclaimedBytes memory usage reduction of the most recent heap trim
+	 * @return the number of heap trims performed since the previous call
+	 */
+	U_64 reportHeapTrimStats(U_64 *totalReclaimedBytes, U_64 *lastReclaimedBytes);
+
 	/**
 	 * construct the object
 	 */
 	MM_IdleGCManager(MM_EnvironmentBase* env)
 		: MM_BaseNonVirtual()
 		, _javaVM((J9JavaVM*)env->getOmrVM()->_language_vm)
+		, _extensions(MM_GCExtensions::getExtensions(env))
+		, _gcOnIdle(false)
+		, _heapTrimMonitor(NULL)
+		, _heapTrimThreadState(HEAP_TRIM_THREAD_NOT_STARTED)
+		, _heapTrimCount(0)
+		, _heapTrimReclaimedBytes(0)
+		, _heapTrimLastReclaimedBytes(0)
+		, _heapTrimReportedCount(0)
+		, _heapTrimBackoff(1)
 	{
 		_typeId = __FUNCTION__;
 	}
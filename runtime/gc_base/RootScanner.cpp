@@ -732,7 +732,7 @@ MM_RootScanner::scanOwnableSynchronizerObjects(MM_EnvironmentBase *env)
 }
 
 /**
- * Scan the per-thread object monitor lookup caches.
+ * Scan the per-thread object monitor lookup caches and the shared monitor table lookup index.
  * Note that this is not a root since the cache contains monitors from the global monitor table
  * which will be scanned by scanMonitorReferences. It should be scanned first, however, since
  * scanMonitorReferences may destroy monitors that appear in caches.
@@ -751,6 +751,14 @@ MM_RootScanner::scanMonitorLookupCaches(MM_EnvironmentBase *env)
 			}
 		}
 	}
+	/* The lookup index shared by all threads caches monitors in the same way */
+	if (_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+		j9objectmonitor_t *monitorTableLookupIndex = static_cast<J9JavaVM*>(_omrVM->_language_vm)->monitorTableLookupIndex;
+		UDATA indexSlot = 0;
+		for (; indexSlot < J9VM_MONITOR_TABLE_LOOKUP_INDEX_SIZE; indexSlot++) {
+			doMonitorLookupCacheSlot(&monitorTableLookupIndex[indexSlot]);
+		}
+	}
 	reportScanningEnded(RootScannerEntity_MonitorLookupCaches);
 }
 
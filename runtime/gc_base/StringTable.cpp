@@ -167,6 +167,38 @@ MM_StringTable::hashAtUTF8(UDATA tableIndex, U_8 *utf8Data, UDATA utf8Length, U_
 	return hashAt(tableIndex, (j9object_t)ptr);
 }
 
+j9object_t
+MM_StringTable::cacheAtUTF8(J9JavaVM *javaVM, U_8 *utf8Data, UDATA utf8Length, U_32 hash)
+{
+	j9object_t candidate = *getStringInternCache(hash);
+
+	if (NULL != candidate) {
+		stringTableUTF8Query query;
+		void *ptr;
+
+		query.utf8Data = utf8Data;
+		query.utf8Length = utf8Length;
+		query.hash = hash;
+		ptr = &query;
+		ptr = (void *) ((UDATA) ptr | TYPE_UTF8); /* Least significant bit indicates that this is a pointer to a stringTableUTF8Query */
+
+		/* the hash check rejects most collisions in the cache slot before comparing characters */
+		if ((hash == (U_32)J9VMJAVALANGSTRING_HASH_VM(javaVM, candidate)) && stringHashEqualFn(&candidate, &ptr, javaVM)) {
+#if defined(J9VM_GC_REALTIME)
+			/* As in j9gc_internString, the cached String can only be used if it is live */
+			if (MM_GCExtensions::getExtensions(javaVM->omrVM)->isMetronomeGC()
+				&& (FALSE == j9gc_objaccess_checkStringConstantsLive(javaVM, candidate, candidate))
+			) {
+				return NULL;
+			}
+#endif /* J9VM_GC_REALTIME */
+			return candidate;
+		}
+	}
+
+	return NULL;
+}
+
 j9object_t
 MM_StringTable::hashAtPut(UDATA tableIndex, j9object_t string)
 {
@@ -632,21 +664,32 @@ j9gc_createJavaLangString(J9VMThread *vmThread, U_8 *data, UDATA length, UDATA s
 	 */
 
 	if (internString && !translateSlashes && !isUnicode) {
-		UDATA hash = 0;
+		/* Accumulate in 32 bits so the sub-table index matches the one derived from the String hash */
+		U_32 hash = 0;
 
 		if (isASCII) {
 			for (UDATA i = 0; i < length; ++i) {
 				hash = (hash << 5) - hash + data[i];
 			}
 		} else {
-			hash = VM_VMHelpers::computeHashForUTF8(data, length);
+			hash = (U_32)VM_VMHelpers::computeHashForUTF8(data, length);
 		}
 
-		UDATA tableIndex = stringTable->getTableIndex(hash);
+		/* Most repeated interns hit the cache, which avoids contending on the sub-table monitor */
+		result = stringTable->cacheAtUTF8(vm, data, length, hash);
+		if (NULL != result) {
+			Trc_MM_stringTableCacheHit(vmThread, result);
+		} else {
+			UDATA tableIndex = stringTable->getTableIndex(hash);
+
+			stringTable->lockTable(tableIndex);
+			result = stringTable->hashAtUTF8(tableIndex, data, length, hash);
+			stringTable->unlockTable(tableIndex);
 
-		stringTable->lockTable(tableIndex);
-		result = stringTable->hashAtUTF8(tableIndex, data, length, (U_32)hash);
-		stringTable->unlockTable(tableIndex);
+			if (NULL != result) {
+				*stringTable->getStringInternCache(hash) = result;
+			}
+		}
 	}
 
 	if (NULL == result) {
@@ -849,6 +892,10 @@ j9gc_createJavaLangString(J9VMThread *vmThread, U_8 *data, UDATA length, UDATA s
 			if (NULL == result) {
 				goto nomem;
 			}
+			if (!translateSlashes && !isUnicode) {
+				/* the hash was computed (and stored in the String) by addStringToInternTable */
+				*stringTable->getStringInternCache((U_32)J9VMJAVALANGSTRING_HASH(vmThread, result)) = result;
+			}
 		}
 	}
 
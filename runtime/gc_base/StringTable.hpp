@@ -40,8 +40,8 @@ private:
 	J9HashTable **_table;           /**< pointer to an array of hash sub-tables */
 	omrthread_monitor_t *_mutex;    /**< pointer to an array of monitors associated with each hash sub-table */
 
-    ddr_constant(cacheSize, 511);
-	j9object_t _cache[cacheSize];   /**< interned string table cash */
+    ddr_constant(cacheSize, 4093);
+	j9object_t _cache[cacheSize];   /**< interned string table cache, read without holding any sub-table lock */
 public:
 
 private:
@@ -64,6 +64,17 @@ public:
 	 */
 	j9object_t *getStringInternCache(UDATA hash) { return &_cache[hash % cacheSize]; }
 
+	/**
+	 * Probe the intern cache for a UTF8 string without locking any sub-table.
+	 * A miss is not authoritative: the caller must fall back to hashAtUTF8() under the sub-table lock.
+	 * @param javaVM pointer to the J9JavaVM
+	 * @param utf8Data pointer to UTF8 string data
+	 * @param utf8Length length of the string
+	 * @param hash Java hash value of the string
+	 * @return the cached interned String object or NULL
+	 */
+	j9object_t cacheAtUTF8(J9JavaVM *javaVM, U_8 *utf8Data, UDATA utf8Length, U_32 hash);
+
 	/**
 	 * @return hash sub-table count
 	 */
@@ -479,13 +479,15 @@ j9gc_initialize_heap(J9JavaVM *vm, IDATA *memoryParameterTable, UDATA heapBytesR
 	}
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
-	if (extensions->gcOnIdle) {
-		/* Enable idle tuning only for gencon policy */
-		if (gc_policy_gencon == extensions->configurationOptions._gcPolicy) {
-			extensions->idleGCManager = MM_IdleGCManager::newInstance(&env);
-			if (NULL == extensions->idleGCManager) {
-				goto error_no_memory;
-			}
+	/* Enable idle tuning and heap trimming only for gencon policy, the only policy releasing free heap pages on idle */
+	if (extensions->heapTrimEnabled && (gc_policy_gencon != extensions->configurationOptions._gcPolicy)) {
+		j9nls_printf(PORTLIB, J9NLS_WARNING, J9NLS_GC_OPTIONS_HEAP_TRIM_NOT_SUPPORTED_WARN);
+		extensions->heapTrimEnabled = false;
+	}
+	if ((extensions->gcOnIdle && (gc_policy_gencon == extensions->configurationOptions._gcPolicy)) || extensions->heapTrimEnabled) {
+		extensions->idleGCManager = MM_IdleGCManager::newInstance(&env);
+		if (NULL == extensions->idleGCManager) {
+			goto error_no_memory;
 		}
 	}
 #endif
@@ -535,6 +535,16 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->tarokEnableIncrementalClassGC = false;
 			continue;
 		}
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+		if (try_scan(&scan_start, "tarokEnableDeferredClassSegmentRelease")) {
+			extensions->tarokEnableDeferredClassSegmentRelease = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisableDeferredClassSegmentRelease")) {
+			extensions->tarokEnableDeferredClassSegmentRelease = false;
+			continue;
+		}
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 		if (try_scan(&scan_start, "tarokEnableCompressedCardTable")) {
 			extensions->tarokEnableCompressedCardTable = true;
 			continue;
@@ -1170,6 +1180,36 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->gcOnIdleCompactThreshold = ((float)percentage) / 100.0f;
 			continue;
 		}
+		if (try_scan(&scan_start, "enableHeapTrim")) {
+			extensions->heapTrimEnabled = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "disableHeapTrim")) {
+			extensions->heapTrimEnabled = false;
+			continue;
+		}
+		if (try_scan(&scan_start, "heapTrimInterval=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->heapTrimInterval, "heapTrimInterval=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(0 == extensions->heapTrimInterval) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "heapTrimPressureThreshold=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->heapTrimPressureThreshold, "heapTrimPressureThreshold=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(extensions->heapTrimPressureThreshold > 100) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 #if defined (J9VM_GC_VLHGC)
@@ -40,6 +40,7 @@ static const char *versionString = "Modron $Name: not supported by cvs2svn $";
 
 #include "mmparse.h"
 
+#include "FinalizerSupport.hpp"
 #include "GCExtensions.hpp"
 #include "Math.hpp"
 
@@ -1274,6 +1275,18 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "finalizeBatchSize=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->finalizeBatchSize, "finalizeBatchSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if((extensions->finalizeBatchSize < 1) || (extensions->finalizeBatchSize > J9_FINALIZE_MAX_BATCH_SIZE)) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "-Xgc:finalizeBatchSize", (UDATA)1, (UDATA)J9_FINALIZE_MAX_BATCH_SIZE);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 		if (try_scan(&scan_start, "finalizeMainPriority=")) {
 			if(!scan_udata_helper(vm, &scan_start, &extensions->finalizeMainPriority, "finalizeMainPriority=")) {
 				returnValue = JNI_EINVAL;
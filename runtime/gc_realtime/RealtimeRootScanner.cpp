@@ -277,7 +277,7 @@ MM_RealtimeRootScanner::condYield(U_64 timeSlackNanoSec)
 }
 
 /**
- * Scan the per-thread object monitor lookup caches.
+ * Scan the per-thread object monitor lookup caches and the shared monitor table lookup index.
  * Note that this is not a root since the cache contains monitors from the global monitor table
  * which will be scanned by scanMonitorReferences. It should be scanned first, however, since
  * scanMonitorReferences may destroy monitors that appear in caches.
@@ -302,6 +302,13 @@ MM_RealtimeRootScanner::scanMonitorLookupCaches(MM_EnvironmentBase *env)
 			}
 		}
 	}
+	/* The lookup index shared by all threads caches monitors in the same way. Clearing it is
+	 * idempotent, and mutators only add monitors of live objects to it once it was cleared.
+	 */
+	j9objectmonitor_t *monitorTableLookupIndex = static_cast<J9JavaVM*>(_omrVM->_language_vm)->monitorTableLookupIndex;
+	for (UDATA indexSlot = 0; indexSlot < J9VM_MONITOR_TABLE_LOOKUP_INDEX_SIZE; indexSlot++) {
+		doMonitorLookupCacheSlot(&monitorTableLookupIndex[indexSlot]);
+	}
 	reportScanningEnded(RootScannerEntity_MonitorLookupCaches);
 }
 
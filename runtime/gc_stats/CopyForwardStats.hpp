@@ -73,6 +73,7 @@ public:
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
 
 	uint64_t _cycleStartTime; /**< The start time of a copy forward cycle */
+	uintptr_t _threadCount; /**< The number of GC threads which participated in the copy forward (not merged, set by the main thread) */
 
 private:
 	
@@ -105,6 +106,8 @@ public:
 		_doubleMappedArrayletsCleared = 0;
 		_doubleMappedArrayletsCandidates = 0;
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+
+		_threadCount = 0;
 	}
 	
 	/**
@@ -151,6 +154,8 @@ public:
 		, _doubleMappedArrayletsCleared(0)
 		, _doubleMappedArrayletsCandidates(0)
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+		, _cycleStartTime(0)
+		, _threadCount(0)
 	{}
 };
 
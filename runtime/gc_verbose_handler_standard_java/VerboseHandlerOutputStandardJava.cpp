@@ -79,6 +79,7 @@ void
 MM_VerboseHandlerOutputStandardJava::outputMemoryInfoInnerStanzaInternal(MM_EnvironmentBase *env, UDATA indent, MM_CollectionStatistics *statsBase)
 {
 	MM_VerboseHandlerJava::outputFinalizableInfo(_manager, env, indent);
+	MM_VerboseHandlerJava::outputHeapTrimInfo(_manager, env, indent);
 }
 
 void
@@ -182,8 +183,21 @@ MM_VerboseHandlerOutputStandardJava::handleSlowExclusive(J9HookInterface **hook,
 	char threadName[64];
 	getThreadName(threadName,sizeof(threadName),event->currentThread->omrVMThread);
 
+	/* The slowest responder tells which thread delayed the request. Its top frame is only
+	 * found once the requester has been granted exclusive access, after this hook.
+	 */
+	J9ExclusiveVMAccessResponder *slowestResponder = &event->currentThread->javaVM->exclusiveSlowestResponder;
+	char responderName[64];
+	if (NULL != slowestResponder->thread) {
+		getThreadName(responderName,sizeof(responderName),slowestResponder->thread->omrVMThread);
+	}
+
 	enterAtomicReportingBlock();
 	writer->formatAndOutput(env, 0,"<warning details=\"slow exclusive request due to %s\" threadname=\"%s\" timems=\"%zu\" />", (event->reason == 1)?"JNICritical":"Exclusive Access", threadName, event->timeTaken);
+	if (NULL != slowestResponder->thread) {
+		writer->formatAndOutput(env, 1, "<slowest-responder threadname=\"%s\" responsetimeus=\"%llu\" vmstate=\"0x%zx\" />",
+				responderName, slowestResponder->responseTime, slowestResponder->vmState);
+	}
 	writer->flush(env);
 	exitAtomicReportingBlock();
 
@@ -409,6 +409,18 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 	}
 	outputRememberedSetClearedInfo(env, irrsStats);
 
+	if (0 != copyForwardStats->_threadCount) {
+		/* average stall time per participating thread, so that the effect of the thread count chosen for this copy forward is visible */
+		U_64 syncStallMicros = j9time_hires_delta(0, copyForwardStats->_syncStallTime, J9PORT_TIME_DELTA_IN_MICROSECONDS) / copyForwardStats->_threadCount;
+		U_64 workStallMicros = j9time_hires_delta(0, copyForwardStats->_workStallTime, J9PORT_TIME_DELTA_IN_MICROSECONDS) / copyForwardStats->_threadCount;
+		U_64 completeStallMicros = j9time_hires_delta(0, copyForwardStats->_completeStallTime, J9PORT_TIME_DELTA_IN_MICROSECONDS) / copyForwardStats->_threadCount;
+		writer->formatAndOutput(env, 1, "<gc-threads used=\"%zu\" max=\"%zu\" syncstallms=\"%llu.%03.3llu\" workstallms=\"%llu.%03.3llu\" completestallms=\"%llu.%03.3llu\" />",
+				copyForwardStats->_threadCount, extensions->gcThreadCount,
+				syncStallMicros / 1000, syncStallMicros % 1000,
+				workStallMicros / 1000, workStallMicros % 1000,
+				completeStallMicros / 1000, completeStallMicros % 1000);
+	}
+
 	outputUnfinalizedInfo(env, 1, copyForwardStats->_unfinalizedCandidates, copyForwardStats->_unfinalizedEnqueued);
 	outputOwnableSynchronizerInfo(env, 1, copyForwardStats->_ownableSynchronizerCandidates, (copyForwardStats->_ownableSynchronizerCandidates-copyForwardStats->_ownableSynchronizerSurvived));
 
@@ -33,6 +33,7 @@
 #include "VerboseWriterChain.hpp"
 #include "GCExtensions.hpp"
 #include "FinalizeListManager.hpp"
+#include "IdleGCManager.hpp"
 #include "VerboseBuffer.hpp"
 
 void
@@ -49,6 +50,33 @@ MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager *manager, MM_Envi
 	if((0 != systemCount) || (0 != defaultCount) || (0 != referenceCount) || (0 != classloaderCount)) {
 		manager->getWriterChain()->formatAndOutput(env, indent, "<pending-finalizers system=\"%zu\" default=\"%zu\" reference=\"%zu\" classloader=\"%zu\" />", systemCount, defaultCount, referenceCount, classloaderCount);
 	}
+
+	/* queue depth peak since the previous report, and how long the finalizer took to complete the queued jobs */
+	U_64 lastDrainTime = 0;
+	U_64 maxDrainTime = 0;
+	UDATA peakCount = finalizeListManager->reportQueueStats(&lastDrainTime, &maxDrainTime);
+	if (0 != peakCount) {
+		manager->getWriterChain()->formatAndOutput(env, indent, "<finalizer-queue peak=\"%zu\" lastdrainms=\"%llu.%03.3llu\" maxdrainms=\"%llu.%03.3llu\" />",
+				peakCount, lastDrainTime / 1000, lastDrainTime % 1000, maxDrainTime / 1000, maxDrainTime % 1000);
+	}
+}
+
+void
+MM_VerboseHandlerJava::outputHeapTrimInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent)
+{
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+
+	if (extensions->heapTrimEnabled && (NULL != extensions->idleGCManager)) {
+		U_64 totalReclaimedBytes = 0;
+		U_64 lastReclaimedBytes = 0;
+		U_64 trimCount = extensions->idleGCManager->reportHeapTrimStats(&totalReclaimedBytes, &lastReclaimedBytes);
+		if (0 != trimCount) {
+			manager->getWriterChain()->formatAndOutput(env, indent, "<heap-trim count=\"%llu\" lastreclaimedkb=\"%llu\" totalreclaimedkb=\"%llu\" />",
+					trimCount, lastReclaimedBytes >> 10, totalReclaimedBytes >> 10);
+		}
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 }
 
 bool
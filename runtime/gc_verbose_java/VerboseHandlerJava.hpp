@@ -43,6 +43,14 @@ public:
 	 */
 	static void outputFinalizableInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent);
 
+	/**
+	 * Output heap trim summary, if the heap has been trimmed since the previous summary.
+	 * @param manager
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	static void outputHeapTrimInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent);
+
 	/**
 	 * Output the name of the thread into the buffer.
 	 * @return Whether the thread name was truncated.
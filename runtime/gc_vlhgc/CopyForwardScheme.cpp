@@ -1680,6 +1680,7 @@ MM_CopyForwardScheme::copyForwardCollectionSet(MM_EnvironmentVLHGC *env)
 	/* And perform the copy forward */
 	MM_CopyForwardSchemeTask copyForwardTask(env, _dispatcher, this, env->_cycleState);
 	_dispatcher->run(env, &copyForwardTask);
+	static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats._threadCount = copyForwardTask.getThreadCount();
 
 	copyForwardPostProcess(env);
 }
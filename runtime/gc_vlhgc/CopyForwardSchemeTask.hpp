@@ -31,9 +31,11 @@
 #include "omrmodroncore.h"
 
 #include "CopyForwardScheme.hpp"
+#include "CycleStateVLHGC.hpp"
 #include "EnvironmentVLHGC.hpp"
 #include "InterRegionRememberedSet.hpp"
 #include "ParallelTask.hpp"
+#include "SchedulingDelegate.hpp"
 
 class MM_CycleState;
 
@@ -46,6 +48,16 @@ private:
 public:
 	virtual UDATA getVMStateID() { return OMRVMSTATE_GC_SCAVENGE; };
 
+	/**
+	 * Limit the number of threads dispatched to the count recommended by the scheduling delegate, which
+	 * tracks how efficiently previous copy-forwards made use of their threads.
+	 */
+	virtual uintptr_t getRecommendedWorkingThreads()
+	{
+		MM_SchedulingDelegate *schedulingDelegate = static_cast<MM_CycleStateVLHGC*>(_cycleState)->_schedulingDelegate;
+		return (NULL == schedulingDelegate) ? UDATA_MAX : schedulingDelegate->getRecommendedCopyForwardThreadCount();
+	}
+
 	virtual void run(MM_EnvironmentBase *envBase)
 	{
 		MM_EnvironmentVLHGC *env = MM_EnvironmentVLHGC::getEnvironment(envBase);
@@ -2444,14 +2444,22 @@ MM_IncrementalGenerationalGC::unloadDeadClassLoaders(MM_EnvironmentVLHGC *env)
 		 */
 		classUnloadStats->_endScanTime = j9time_hires_clock();
 		classUnloadStats->_startPostTime = classUnloadStats->_endScanTime;
+		/* segments which a previous deferred release has not yet reached; if the finalizer has fallen this far behind, release everything now */
+		UDATA backlogSize = _extensions->classLoaderManager->reclaimableMemory();
 		/* enqueue all the segments we just salvaged from the dead class loaders for delayed free (this work was historically attributed in the unload end operation so it goes after the timer start) */
 		_extensions->classLoaderManager->enqueueUndeadClassSegments(reclaimedSegments);
 		_extensions->classLoaderManager->cleanUpClassLoadersEnd(env, unloadLink);
 		/* we can now flush these since we don't need to walk any dead objects in Balanced */
 		if (_extensions->classLoaderManager->reclaimableMemory() > 0) {
-			Trc_MM_FlushUndeadSegments_Entry(env->getLanguageVMThread(), "Mark Map Completed");
-			_extensions->classLoaderManager->flushUndeadSegments(env);
-			Trc_MM_FlushUndeadSegments_Exit(env->getLanguageVMThread());
+			if (_extensions->tarokEnableDeferredClassSegmentRelease && (backlogSize <= _extensions->deadClassLoaderCacheSize)) {
+				/* hand the release off to the finalizer thread so that it happens outside of this pause */
+				_extensions->classLoaderManager->requestDeferredUndeadSegmentsFlush();
+				env->_cycleState->_finalizationRequired = true;
+			} else {
+				Trc_MM_FlushUndeadSegments_Entry(env->getLanguageVMThread(), "Mark Map Completed");
+				_extensions->classLoaderManager->flushUndeadSegments(env);
+				Trc_MM_FlushUndeadSegments_Exit(env->getLanguageVMThread());
+			}
 		}
 		classUnloadStats->_endPostTime = j9time_hires_clock();
 
@@ -60,6 +60,13 @@ const double measureScanRateHistoricWeightForPGC = 0.95;
 const double partialGCTimeHistoricWeight = 0.80;
 const double incrementalScanTimePerGMPHistoricWeight = 0.50;
 const double bytesScannedConcurrentlyPerGMPHistoricWeight = 0.50;
+const double copyForwardStallRatioHistoricWeight = 0.70;
+/* stall ratio above which copy-forward threads are considered to mostly wait on each other */
+const double copyForwardStallRatioShrinkThreshold = 0.40;
+/* stall ratio below which copy-forward could probably make use of more threads */
+const double copyForwardStallRatioGrowThreshold = 0.15;
+/* the least amount of expected copy-forward work, in microseconds, worth starting another thread for */
+const double copyForwardMinimumWorkPerThreadMicros = 500.0;
 
 MM_SchedulingDelegate::MM_SchedulingDelegate (MM_EnvironmentVLHGC *env, MM_HeapRegionManager *manager)
 	: MM_BaseNonVirtual()
@@ -86,6 +93,8 @@ MM_SchedulingDelegate::MM_SchedulingDelegate (MM_EnvironmentVLHGC *env, MM_HeapR
 	, _averageCopyForwardBytesDiscarded(0.0)
 	, _averageSurvivorSetRegionCount(0.0)
 	, _averageCopyForwardRate(1.0)
+	, _averageCopyForwardStallRatio(0.0)
+	, _copyForwardThreadCount(_extensions->gcThreadCount)
 	, _averageMacroDefragmentationWork(0.0)
 	, _currentMacroDefragmentationWork(0)
 	, _didGMPCompleteSinceLastReclaim(false)
@@ -901,6 +910,7 @@ MM_SchedulingDelegate::copyForwardCompleted(MM_EnvironmentVLHGC *env)
 	
 	_averageSurvivorSetRegionCount = (_averageSurvivorSetRegionCount * historicWeight) + ((double)survivorSetRegionCount * (1.0 - historicWeight));
 	_averageCopyForwardRate = (_averageCopyForwardRate * historicWeight) + (copyForwardRate * (1.0 - historicWeight));
+	updateCopyForwardThreadCount(env);
 
 	Trc_MM_SchedulingDelegate_copyForwardCompleted_efficiency(
 		env->getLanguageVMThread(),
@@ -919,6 +929,43 @@ MM_SchedulingDelegate::copyForwardCompleted(MM_EnvironmentVLHGC *env)
 		);
 }
 
+void
+MM_SchedulingDelegate::updateCopyForwardThreadCount(MM_EnvironmentVLHGC *env)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_CopyForwardStats *copyForwardStats = &(static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats);
+	UDATA maximumThreadCount = _extensions->gcThreadCount;
+	UDATA threadsUsed = copyForwardStats->_threadCount;
+	U_64 elapsedMicros = j9time_hires_delta(copyForwardStats->_startTime, copyForwardStats->_endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+
+	if (!_extensions->adaptiveGCThreading) {
+		_copyForwardThreadCount = maximumThreadCount;
+	} else if ((0 != threadsUsed) && (0 != elapsedMicros)) {
+		U_64 stallMicros = j9time_hires_delta(0, copyForwardStats->getStallTime(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+		double stallRatio = OMR_MIN(1.0, (double)stallMicros / ((double)elapsedMicros * (double)threadsUsed));
+		_averageCopyForwardStallRatio = (_averageCopyForwardStallRatio * copyForwardStallRatioHistoricWeight) + (stallRatio * (1.0 - copyForwardStallRatioHistoricWeight));
+
+		/* the number of threads which, on average, were doing useful work */
+		double busyThreads = OMR_MAX(1.0, (double)threadsUsed * (1.0 - _averageCopyForwardStallRatio));
+		UDATA threadCount = threadsUsed;
+		if (_averageCopyForwardStallRatio > copyForwardStallRatioShrinkThreshold) {
+			threadCount = (UDATA)busyThreads;
+		} else if (_averageCopyForwardStallRatio < copyForwardStallRatioGrowThreshold) {
+			threadCount = threadsUsed + OMR_MAX(1, threadsUsed / 4);
+		}
+
+		/* don't use more threads than the expected amount of work can keep busy: estimate the single-threaded cost of the next copy-forward from the per-thread rate */
+		double bytesPerThreadMicro = _averageCopyForwardRate / busyThreads;
+		if (bytesPerThreadMicro > 0.0) {
+			double expectedWorkMicros = _averageCopyForwardBytesCopied / bytesPerThreadMicro;
+			UDATA workThreadCount = (UDATA)(expectedWorkMicros / copyForwardMinimumWorkPerThreadMicros) + 1;
+			threadCount = OMR_MIN(threadCount, workThreadCount);
+		}
+
+		_copyForwardThreadCount = OMR_MAX(1, OMR_MIN(threadCount, maximumThreadCount));
+	}
+}
+
 double
 MM_SchedulingDelegate::calculateAverageCopyForwardRate(MM_EnvironmentVLHGC *env)
 {
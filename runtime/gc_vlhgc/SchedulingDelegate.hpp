@@ -64,6 +64,8 @@ private:
 	double _averageCopyForwardBytesDiscarded; /**< Weighted average of bytes discarded (lost) by the copy-forward scheme */
 	double _averageSurvivorSetRegionCount; /**< Weighted average of survivor regions */
 	double _averageCopyForwardRate; /**< Weighted average of (bytesCopied / timeSpentInCopyForward).  Disregards time spent related RSCL clearing. Measured in bytes/microseconds */
+	double _averageCopyForwardStallRatio; /**< Weighted average of the fraction of copy-forward thread time spent stalled (synchronizing or waiting for work) */
+	UDATA _copyForwardThreadCount; /**< The number of GC threads recommended for the next copy-forward (see updateCopyForwardThreadCount) */
 	double _averageMacroDefragmentationWork; /**< Average work to be done to mitigate influx of fragmented regions into the oldest age */
 	UDATA _currentMacroDefragmentationWork;	 /**< As we age out regions and find macro defrag work, we sum it up */
 	bool _didGMPCompleteSinceLastReclaim; /**< true if a GMP completed since the last reclaim cycle */
@@ -237,6 +239,15 @@ private:
 	 */
 	double calculateAverageCopyForwardRate(MM_EnvironmentVLHGC *env);
 
+	/**
+	 * Called after a copy forward to recompute the number of GC threads recommended for the next one.
+	 * Threads are removed while the measured stall ratio shows they mostly wait on each other, added
+	 * back while it shows they are kept busy, and capped so that each thread gets a minimum amount
+	 * of expected copy work (derived from the average bytes copied and the average copy-forward rate).
+	 * @param env[in] the main GC thread
+	 */
+	void updateCopyForwardThreadCount(MM_EnvironmentVLHGC *env);
+
 	/**
 	 * Estimate total free memory
 	 * @param env[in] the main GC thread
@@ -299,6 +310,21 @@ public:
 	 */
 	double getAverageCopyForwardRate() { return _averageCopyForwardRate; }
 
+	/**
+	 * Returns the number of GC threads which should participate in the next copy-forward.  This is the
+	 * GC thread count unless -XX:+AdaptiveGCThreading is in effect.
+	 *
+	 * @return the recommended copy-forward thread count
+	 */
+	UDATA getRecommendedCopyForwardThreadCount() { return _copyForwardThreadCount; }
+
+	/**
+	 * Returns the average fraction of copy-forward thread time spent stalled.
+	 *
+	 * @return the average copy-forward stall ratio
+	 */
+	double getAverageCopyForwardStallRatio() { return _averageCopyForwardStallRatio; }
+
 	/*
 	 * Returns the scan time cost (in microseconds) we attribute to performing a GMP.  Attempts to
 	 * factor in stop-the-world global mark increment time as well as any concurrent global marking which
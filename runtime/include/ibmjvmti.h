@@ -183,8 +183,9 @@ enum {
  */ 
 
 enum {
-	COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID = 0,
-	COM_IBM_JLM_DUMP_FORMAT_TAGS      = 1
+	COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID   = 0,
+	COM_IBM_JLM_DUMP_FORMAT_TAGS        = 1,
+	COM_IBM_JLM_DUMP_FORMAT_SPIN_STATS  = 2	/** Like COM_IBM_JLM_DUMP_FORMAT_TAGS, followed by the object monitor spin statistics */
 };
 
 
@@ -434,6 +434,8 @@ JVM_FillInStackTrace(JNIEnv* env, jobject throwable)
 		UDATA rc = 0;
 		UDATA i = 0;
 		UDATA framesWalked = 0;
+		UDATA shapeHash = 0;
+		BOOLEAN deduplicate = FALSE;
 
 		/* Do not hide exception frames if fillInStackTrace is called on an exception which already has a stack trace.  In the out of memory case,
 		 * there is a bit indicating that we should explicitly override this behaviour, since we've precached the stack trace array. */
@@ -472,6 +474,15 @@ JVM_FillInStackTrace(JNIEnv* env, jobject throwable)
 #else
 			J9Class* arrayClass = javaVM->intArrayClass;
 #endif
+			/* Only walkbacks filled in for the first time may be shared, see FastJNI_java_lang_Throwable.cpp */
+			if ((NULL == result) && J9_ARE_ANY_BITS_SET(javaVM->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_DEDUPLICATE_STACK_TRACES)) {
+				result = vmfns->findDeduplicatedStackTrace(currentThread, walkState->cache, framesWalked, &shapeHash);
+				if (NULL != result) {
+					vmfns->freeStackWalkCaches(currentThread, walkState);
+					goto setThrowableSlots;
+				}
+				deduplicate = TRUE;
+			}
 			result = javaVM->memoryManagerFunctions->J9AllocateIndexableObject(currentThread, arrayClass, (U_32)framesWalked, J9_GC_ALLOCATE_OBJECT_NON_INSTRUMENTABLE);
 			if (NULL == result) {
 				vmfns->setHeapOutOfMemoryError(currentThread);
@@ -489,6 +500,9 @@ JVM_FillInStackTrace(JNIEnv* env, jobject throwable)
 		for (i = 0; i < framesWalked; ++i) {
 			J9JAVAARRAYOFUDATA_STORE(currentThread, result, i, walkState->cache[i]);
 		}
+		if (deduplicate) {
+			vmfns->cacheDeduplicatedStackTrace(currentThread, result, shapeHash);
+		}
 
 		vmfns->freeStackWalkCaches(currentThread, walkState);
 
@@ -168,6 +168,10 @@ standardInit( J9JavaVM *vm, char *dllName)
 		if (JNI_OK == result) {
 			result = vmFuncs->initializeHeapOOMMessage(vmThread);
 		}
+
+		if (JNI_OK == result) {
+			result = vmFuncs->initializeStackTraceDedupCache(vmThread);
+		}
 		
 		if (JNI_OK == result) {
 			U_32 runtimeFlags = computeJCLRuntimeFlags(vm);
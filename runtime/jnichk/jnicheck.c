@@ -112,6 +112,8 @@ J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 			}
 
 			vm->jniFunctionTable = GLOBAL_TABLE(JNICheckTable);
+			/* Deleted global refs must leave the pools for the checks to see them as invalid */
+			vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_CHECK_JNI;
 			if (omrthread_tls_alloc(&jniEntryCountKey)) {
 				return J9VMDLLMAIN_FAILED;
 			}
@@ -1206,6 +1206,9 @@ redefineClassesCommon(jvmtiEnv* env,
 			/* Flush the reflect method cache */
 			flushClassLoaderReflectCache(currentThread, classPairs);
 
+			/* Flush the method lookup caches */
+			flushMethodLookupCaches(currentThread);
+
 			/* Store the method remap indices for redefined interface classes */
 			updateInterfaceMethodOrdering(currentThread, class_count, specifiedClasses);
 
@@ -1249,6 +1252,9 @@ redefineClassesCommon(jvmtiEnv* env,
 			/* Unresolve all classes */
 			unresolveAllClasses(currentThread, classPairs, methodPairs, extensionsUsed);
 
+			/* Flush the method lookup caches */
+			flushMethodLookupCaches(currentThread);
+
 			/* Update method equivalences. Propagate any equivalent resolved callsites. */
 			rc = fixMethodEquivalencesAndCallSites(currentThread, classPairs, jitEventDataPtr, FALSE, &methodEquivalences, extensionsUsed);
 			if (rc != JVMTI_ERROR_NONE) {
@@ -2720,7 +2720,7 @@ jvmtiJlmDumpStats(jvmtiEnv* env, void ** dump_info, jint dump_format, ...)
 	ENSURE_PHASE_LIVE(env);
 	ENSURE_NON_NULL(dump_info);
 
-    if ( (dump_format < COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) || (dump_format > COM_IBM_JLM_DUMP_FORMAT_TAGS)) {
+    if ( (dump_format < COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) || (dump_format > COM_IBM_JLM_DUMP_FORMAT_SPIN_STATS)) {
         rc = JVMTI_ERROR_ILLEGAL_ARGUMENT;
         goto done;
     }
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#if !defined(CONTINUATIONHELPERS_HPP_)
+#define CONTINUATIONHELPERS_HPP_
+
+#include "j9.h"
+#include "j9consts.h"
+
+#include "AtomicSupport.hpp"
+
+class VM_ContinuationHelpers {
+	/*
+	 * Data members
+	 */
+private:
+
+protected:
+
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+
+	template <typename T>
+	static VMINLINE void
+	swapMember(T &threadField, T &continuationField)
+	{
+		T temp = threadField;
+		threadField = continuationField;
+		continuationField = temp;
+	}
+
+protected:
+
+public:
+
+	/**
+	 * Exchange the stack and interpreter state of a thread with the state saved in a
+	 * continuation. Used both to mount the continuation on the thread and to unmount it.
+	 *
+	 * @param vmThread[in] the current J9VMThread
+	 * @param continuation[in] the continuation
+	 */
+	static VMINLINE void
+	swapFieldsWithContinuation(J9VMThread *vmThread, J9VMContinuation *continuation)
+	{
+		swapMember(vmThread->arg0EA, continuation->arg0EA);
+		swapMember(vmThread->bytecodes, continuation->bytecodes);
+		swapMember(vmThread->sp, continuation->sp);
+		swapMember(vmThread->pc, continuation->pc);
+		swapMember(vmThread->literals, continuation->literals);
+		swapMember(vmThread->stackObject, continuation->stackObject);
+		swapMember(vmThread->decompilationStack, continuation->decompilationStack);
+		swapMember(vmThread->j2iFrame, continuation->j2iFrame);
+		swapMember(vmThread->entryLocalStorage->i2jState, continuation->i2jState);
+		swapMember(vmThread->stackOverflowMark2, continuation->stackOverflowMark2);
+		/* Monitor enter records and JNI reference frames come from pools of the thread, and a
+		 * continuation starts with none, so one that is unmounted holds none of them.
+		 */
+		swapMember(vmThread->monitorEnterRecords, continuation->monitorEnterRecords);
+		swapMember(vmThread->jniMonitorEnterRecords, continuation->jniMonitorEnterRecords);
+		swapMember(vmThread->jniLocalReferences, continuation->jniLocalReferences);
+
+		/* As when the stack grows, do not lose an async event posted in stackOverflowMark */
+		UDATA currentStackOverflowMark = (UDATA)vmThread->stackOverflowMark;
+		if (J9_EVENT_SOM_VALUE != currentStackOverflowMark) {
+			VM_AtomicSupport::lockCompareExchange((UDATA*)&vmThread->stackOverflowMark, currentStackOverflowMark, (UDATA)vmThread->stackOverflowMark2);
+		}
+		continuation->stackOverflowMark = continuation->stackOverflowMark2;
+	}
+
+	/**
+	 * Fill in a J9VMThread with the stack state saved in a continuation, so that the stack
+	 * walker can walk the saved stack using that thread as its walkThread.
+	 *
+	 * @param currentThread[in] the current J9VMThread
+	 * @param vmThread[in] a zeroed J9VMThread to fill in
+	 * @param els[in] a zeroed J9VMEntryLocalStorage to fill in
+	 * @param continuation[in] the continuation
+	 */
+	static VMINLINE void
+	copyFieldsFromContinuation(J9VMThread *currentThread, J9VMThread *vmThread, J9VMEntryLocalStorage *els, J9VMContinuation *continuation)
+	{
+		vmThread->javaVM = currentThread->javaVM;
+		vmThread->arg0EA = continuation->arg0EA;
+		vmThread->bytecodes = continuation->bytecodes;
+		vmThread->sp = continuation->sp;
+		vmThread->pc = continuation->pc;
+		vmThread->literals = continuation->literals;
+		vmThread->stackOverflowMark = continuation->stackOverflowMark;
+		vmThread->stackOverflowMark2 = continuation->stackOverflowMark2;
+		vmThread->stackObject = continuation->stackObject;
+		vmThread->decompilationStack = continuation->decompilationStack;
+		vmThread->j2iFrame = continuation->j2iFrame;
+		els->i2jState = continuation->i2jState;
+		/* While the continuation is mounted it holds the carrier's stack, below which the
+		 * older entry local storages of the carrier are found.
+		 */
+		if (NULL != continuation->carrierThread) {
+			els->oldEntryLocalStorage = continuation->carrierThread->entryLocalStorage->oldEntryLocalStorage;
+		}
+		vmThread->entryLocalStorage = els;
+	}
+};
+
+#endif /* CONTINUATIONHELPERS_HPP_ */
@@ -283,7 +283,9 @@ public:
 	}
 
 	/**
-	 * Update the vm's J9ExclusiveVMStats structure once currentThread has responded.
+	 * Update the vm's J9ExclusiveVMStats structure, the response time histogram, the
+	 * slowest responder and the response time of currentThread once it has responded. Caller must hold vm->exclusiveAccessMutex.
+	 * Only cheap bookkeeping may be done here, as every responder runs it under the mutex.
 	 *
 	 * @parm[in] currentThread the thread responding
 	 * @parm[in] vm the J9JavaVM
@@ -305,6 +307,25 @@ public:
 		vm->omrVM->exclusiveVMAccessStats.totalResponseTime += (timeNow - exclusiveStartTime);
 		vm->omrVM->exclusiveVMAccessStats.lastResponder = (NULL == currentThread ? NULL : currentThread->omrVMThread);
 		vm->omrVM->exclusiveVMAccessStats.haltedThreads += 1;
+
+		/* Attribute the time to safepoint to the individual responders */
+		U_64 const responseTime = j9time_hires_delta(exclusiveStartTime, timeNow, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+		UDATA bucket = 0;
+		for (U_64 bound = 1; (responseTime >= bound) && (bucket < (J9VM_EXCLUSIVE_RESPONSE_HISTOGRAM_SIZE - 1)); bound <<= 1) {
+			bucket += 1;
+		}
+		vm->exclusiveResponseHistogram[bucket] += 1;
+		/* All response times are measured from the same start, so the slowest responder is the last one */
+		if (NULL != currentThread) {
+			/* Reported and cleared by the requester once exclusive access has been granted */
+			currentThread->exclusiveResponseTime = responseTime;
+			currentThread->exclusiveResponseVMState = currentThread->omrVMThread->vmState;
+			vm->exclusiveSlowestResponder.thread = currentThread;
+			vm->exclusiveSlowestResponder.responseTime = responseTime;
+			vm->exclusiveSlowestResponder.vmState = currentThread->omrVMThread->vmState;
+			/* Filled in by the requester once exclusive access has been granted */
+			vm->exclusiveSlowestResponder.method = NULL;
+		}
 		return timeNow;
 	}
 
@@ -341,6 +341,8 @@ extern "C" {
 #define J9_EXTENDED_RUNTIME2_VALUE_BASED_WARNING 0x2000
 #define J9_EXTENDED_RUNTIME2_LOAD_HEALTHCENTER_MODULE 0x4000
 #define J9_EXTENDED_RUNTIME2_3164_INTEROPERABILITY 0x8000
+#define J9_EXTENDED_RUNTIME2_DEDUPLICATE_STACK_TRACES 0x10000
+#define J9_EXTENDED_RUNTIME2_CHECK_JNI 0x20000
 
 #define J9_OBJECT_HEADER_AGE_DEFAULT 0xA /* OBJECT_HEADER_AGE_DEFAULT */
 #define J9_OBJECT_HEADER_SHAPE_MASK 0xE /* OBJECT_HEADER_SHAPE_MASK */
@@ -39,6 +39,9 @@
 
 #define J9VM_DLT_HISTORY_SIZE  16
 #define J9VM_OBJECT_MONITOR_CACHE_SIZE  32
+#define J9VM_MONITOR_TABLE_LOOKUP_INDEX_SIZE  1024
+#define J9VM_STACK_TRACE_DEDUP_CACHE_SIZE  256
+#define J9VM_JNI_GLOBAL_REF_CACHE_SIZE  32
 #define J9VM_ASYNC_MAX_HANDLERS 32
 
 /* The bit fields used by verifyQualifiedName to verify a qualified class name */
@@ -1147,7 +1150,7 @@ typedef struct J9SharedCacheHeader {
 	UDATA updateCount;
 	J9WSRP updateCountPtr;
 	volatile UDATA readerCount;
-	UDATA unused2;
+	volatile UDATA lockGeneration;
 	UDATA writeHash;
 	UDATA unused3;
 	UDATA unused4;
@@ -1188,12 +1191,12 @@ typedef struct J9SharedCacheHeader {
 	UDATA corruptValue;
 	UDATA lastMetadataType;
 	UDATA writerCount;
-	UDATA unused5;
-	UDATA unused6;
+	UDATA romClassCountHint;
+	UDATA classpathCountHint;
 	U_32 softMaxBytes;
-	UDATA unused8;
-	UDATA unused9;
-	UDATA unused10;
+	UDATA compiledMethodCountHint;
+	UDATA byteDataCountHint;
+	UDATA attachedDataCountHint;
 } J9SharedCacheHeader;
 
 #define J9SHAREDCACHEHEADER_UPDATECOUNTPTR(base) WSRP_GET((base)->updateCountPtr, UDATA*)
@@ -1241,6 +1244,9 @@ typedef struct J9SharedCacheAPI {
 	U_8 sharedCacheEnabled;
 	U_8 inContainer; /* It is TRUE only when xShareClassesPresent is FALSE and J9_SHARED_CACHE_DEFAULT_BOOT_SHARING(vm) is TRUE and the JVM is running in container */
 	I_8 layer;
+	U_32 timestampCheckIntervalMillis;
+	U_32 compressByteDataMinBytes;
+	U_32 mmapFlags;
 } J9SharedCacheAPI;
 
 typedef struct J9SharedClassConfig {
@@ -1512,6 +1518,9 @@ typedef struct J9ObjectMonitor {
 #endif /* J9VM_THR_SMART_DEFLATION */
 	j9objectmonitor_t alternateLockword;
 	U_32 hash;
+	U_32 spinBudget;
+	U_32 spinAcquireCount;
+	U_32 spinFailCount;
 } J9ObjectMonitor;
 
 typedef struct J9ClassWalkState {
@@ -1542,6 +1551,8 @@ typedef struct J9DbgROMClassBuilder {
 	U_8* anonClassNameBuffer;
 	UDATA anonClassNameBufferSize;
 	U_8* bufferManagerBuffer;
+	void* spareClassFileBuffers;
+	UDATA spareClassFileBufferCount;
 	struct J9DbgStringInternTable stringInternTable;
 } J9DbgROMClassBuilder;
 
@@ -3136,6 +3147,29 @@ typedef struct J9ClassLocation {
 #define LOAD_LOCATION_CLASSPATH 2
 #define LOAD_LOCATION_MODULE 3
 
+/* @ddr_namespace: map_to_type=J9MethodLookupIndex */
+
+/* Hash index of the methods declared by a class, keyed by name and signature. Each slot
+ * holds the index of a method in ramMethods plus 1, or 0 if the slot is empty.
+ */
+typedef struct J9MethodLookupIndex {
+	U_32 slotMask;
+	U_32 slots[1];
+} J9MethodLookupIndex;
+
+#define J9VM_METHOD_LOOKUP_INDEX_MIN_METHODS 8
+
+/* @ddr_namespace: map_to_type=J9MethodLookupCache */
+
+/* Direct mapped cache of the methods which exact lookups from a class found in its superclasses,
+ * keyed by name and signature. A NULL entry is empty. Flushed when classes are redefined.
+ */
+#define J9VM_METHOD_LOOKUP_CACHE_SIZE 16
+
+typedef struct J9MethodLookupCache {
+	struct J9Method* methods[J9VM_METHOD_LOOKUP_CACHE_SIZE];
+} J9MethodLookupCache;
+
 typedef struct J9Class {
 	UDATA eyecatcher;
 	struct J9ROMClass* romClass;
@@ -3169,7 +3203,7 @@ typedef struct J9Class {
 	void** jniIDs;
 	UDATA lockOffset;
 #if defined(J9VM_ENV_DATA64)
-	U_32 paddingForGLRCounters; /* This is used to preserve alignment under 64 bit. */
+	U_32 monitorTableCounter; /* This is also used to preserve alignment under 64 bit. */
 #endif /* defined(J9VM_ENV_DATA64) */
 	U_16 reservedCounter;
 	U_16 cancelCounter;
@@ -3199,6 +3233,8 @@ typedef struct J9Class {
 #endif /* JAVA_SPEC_VERSION >= 11 */
 	struct J9FlattenedClassCache* flattenedClassCache;
 	struct J9ClassHotFieldsInfo* hotFieldsInfo;
+	struct J9MethodLookupIndex* methodLookupIndex;
+	struct J9MethodLookupCache* methodLookupCache;
 } J9Class;
 
 /* Interface classes can never be instantiated, so the following fields in J9Class will not be used:
@@ -3257,7 +3293,7 @@ typedef struct J9ArrayClass {
 	void** jniIDs;
 	UDATA lockOffset;
 #if defined(J9VM_ENV_DATA64)
-	U_32 paddingForGLRCounters; /* This is used to preserve alignment under 64 bit. */
+	U_32 monitorTableCounter; /* This is also used to preserve alignment under 64 bit. */
 #endif /* defined(J9VM_ENV_DATA64) */
 	U_16 reservedCounter;
 	U_16 cancelCounter;
@@ -3288,6 +3324,8 @@ typedef struct J9ArrayClass {
 	/* Added temporarily for consistency */
 	UDATA flattenedElementSize;
 	struct J9ClassHotFieldsInfo* hotFieldsInfo;
+	struct J9MethodLookupIndex* methodLookupIndex;
+	struct J9MethodLookupCache* methodLookupCache;
 } J9ArrayClass;
 
 
@@ -4701,6 +4739,9 @@ typedef struct J9InternalVMFunctions {
 	void  ( *clearHaltFlag)(struct J9VMThread * vmThread, UDATA flag) ;
 	void  ( *setHeapOutOfMemoryError)(struct J9VMThread * currentThread) ;
 	jint  ( *initializeHeapOOMMessage)(struct J9VMThread *currentThread) ;
+	jint  ( *initializeStackTraceDedupCache)(struct J9VMThread *currentThread) ;
+	j9object_t  ( *findDeduplicatedStackTrace)(struct J9VMThread *currentThread, UDATA *frames, UDATA frameCount, UDATA *shapeHash) ;
+	void  ( *cacheDeduplicatedStackTrace)(struct J9VMThread *currentThread, j9object_t walkback, UDATA shapeHash) ;
 	void  ( *threadAboutToStart)(struct J9VMThread *currentThread) ;
 	void  ( *mustHaveVMAccess)(struct J9VMThread * vmThread) ;
 #if defined(J9VM_PORT_ZOS_CEEHDLRSUPPORT)
@@ -4798,6 +4839,11 @@ typedef struct J9InternalVMFunctions {
 	BOOLEAN (*isCRIUSupportEnabled)(struct J9VMThread *currentThread);
 	BOOLEAN (*isCheckpointAllowed)(struct J9VMThread *currentThread);
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
+	struct J9VMContinuation* (*createContinuation)(struct J9VMThread *currentThread, UDATA stackSize);
+	void (*freeContinuation)(struct J9VMThread *currentThread, struct J9VMContinuation *continuation);
+	BOOLEAN (*mountContinuation)(struct J9VMThread *currentThread, struct J9VMContinuation *continuation);
+	struct J9VMContinuation* (*unmountContinuation)(struct J9VMThread *currentThread);
+	UDATA (*walkContinuationStackFrames)(struct J9VMThread *currentThread, struct J9VMContinuation *continuation, struct J9StackWalkState *walkState);
 } J9InternalVMFunctions;
 
 /* Jazz 99339: define a new structure to replace JavaVM so as to pass J9NativeLibrary to JVMTIEnv  */
@@ -4808,6 +4854,31 @@ typedef struct J9InvocationJavaVM {
 	J9NativeLibrary * reserved2_library;
 } J9InvocationJavaVM;
 
+/* @ddr_namespace: map_to_type=J9VMContinuation */
+
+/* The stack and interpreter state of a continuation. While the continuation is mounted on a
+ * carrier J9VMThread, the fields hold the state of the carrier's own stack instead.
+ */
+typedef struct J9VMContinuation {
+	UDATA* arg0EA;
+	UDATA* bytecodes;
+	UDATA* sp;
+	U_8* pc;
+	struct J9Method* literals;
+	UDATA* stackOverflowMark;
+	UDATA* stackOverflowMark2;
+	struct J9JavaStack* stackObject;
+	struct J9JITDecompilationInfo* decompilationStack;
+	UDATA* j2iFrame;
+	struct J9I2JState i2jState;
+	struct J9MonitorEnterRecord* monitorEnterRecords;
+	struct J9MonitorEnterRecord* jniMonitorEnterRecords;
+	UDATA* jniLocalReferences;
+	struct J9VMThread* carrierThread;
+	struct J9VMContinuation* linkNext;
+	struct J9VMContinuation* linkPrevious;
+} J9VMContinuation;
+
 /* @ddr_namespace: map_to_type=J9VMThread */
 
 typedef struct J9VMThread {
@@ -4976,6 +5047,8 @@ typedef struct J9VMThread {
 	void* jniCalloutArgs;
 	struct J9VMThread* exclusiveVMAccessQueueNext;
 	struct J9VMThread* exclusiveVMAccessQueuePrevious;
+	U_64 exclusiveResponseTime;
+	UDATA exclusiveResponseVMState;
 	j9object_t javaLangThreadLocalCache;
 	UDATA jitCountDelta;
 	UDATA maxProfilingCount;
@@ -5041,6 +5114,11 @@ typedef struct J9VMThread {
 #endif /* OMR_GC_COMPRESSED_POINTERS */
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	UDATA safePointCount;
+	j9object_t* jniGlobalRefCache[J9VM_JNI_GLOBAL_REF_CACHE_SIZE];
+	UDATA jniGlobalRefCacheCount;
+	j9object_t* jniWeakGlobalRefCache[J9VM_JNI_GLOBAL_REF_CACHE_SIZE];
+	UDATA jniWeakGlobalRefCacheCount;
+	struct J9VMContinuation* currentContinuation;
 } J9VMThread;
 
 #define J9VMTHREAD_ALIGNMENT  0x100
@@ -5084,6 +5162,14 @@ typedef struct J9VMThread {
 #define J9VMSTATE_SNW_STACK_VALIDATE  0x110000
 #define J9VMSTATE_GP  0xFFFF0000
 #define J9VMTHREAD_OBJECT_MONITOR_CACHE_SIZE  J9VM_OBJECT_MONITOR_CACHE_SIZE
+#define J9VMTHREAD_JNI_GLOBAL_REF_CACHE_SIZE  J9VM_JNI_GLOBAL_REF_CACHE_SIZE
+
+/* A JNI global or weak global reference is a pool element holding the object slot, which the jobject
+ * points to, followed by a tag. The tag is the address of the pool while the reference is live and 0
+ * once it has been deleted, so that a deletion can be validated without taking the jniFrameMutex.
+ */
+#define J9JNI_GLOBAL_REF_ELEMENT_SIZE  (2 * sizeof(UDATA))
+#define J9JNI_GLOBAL_REF_TAG_EA(ref)  (((UDATA*)(ref)) + 1)
 
 #define J9VMTHREAD_BLOCKINGENTEROBJECT(currentThread, targetThread) J9VMTHREAD_JAVAVM(targetThread)->memoryManagerFunctions->j9gc_objaccess_readObjectFromInternalVMSlot((currentThread), J9VMTHREAD_JAVAVM(targetThread), (j9object_t*)&((targetThread)->blockingEnterObject))
 #define J9VMTHREAD_SET_BLOCKINGENTEROBJECT(currentThread, targetThread, value) J9VMTHREAD_JAVAVM(targetThread)->memoryManagerFunctions->j9gc_objaccess_storeObjectToInternalVMSlot((currentThread), (j9object_t*)&((targetThread)->blockingEnterObject), (value))
@@ -5139,6 +5225,25 @@ typedef struct J9VMRuntimeStateListener {
 #define J9VM_RUNTIME_STATE_LISTENER_ABORT 3
 #define J9VM_RUNTIME_STATE_LISTENER_TERMINATED 4
 
+/* Number of buckets of J9JavaVM.exclusiveResponseHistogram. Bucket 0 counts responses
+ * faster than 1 microsecond, bucket n responses in [2^(n-1), 2^n) microseconds, and the
+ * last bucket all slower responses.
+ */
+#define J9VM_EXCLUSIVE_RESPONSE_HISTOGRAM_SIZE 20
+
+/* Response time in microseconds above which a thread is reported as a slow responder to an exclusive access request */
+#define J9VM_EXCLUSIVE_SLOW_RESPONSE_THRESHOLD 1000
+
+/* The thread which was the slowest, i.e. the last, to respond to the current or last exclusive access request.
+ * method is the responder's top frame, found once exclusive access has been granted if slow responders are traced.
+ */
+typedef struct J9ExclusiveVMAccessResponder {
+	struct J9VMThread* thread;
+	U_64 responseTime;
+	UDATA vmState;
+	struct J9Method* method;
+} J9ExclusiveVMAccessResponder;
+
 /* @ddr_namespace: map_to_type=J9JavaVM */
 
 typedef struct J9JavaVM {
@@ -5216,6 +5321,7 @@ typedef struct J9JavaVM {
 	struct J9RAMConstantPoolItem jclConstantPool[J9VM_VMCONSTANTPOOL_SIZE];
 	struct J9VMThread* mainThread;
 	struct J9VMThread* deadThreadList;
+	struct J9VMContinuation* continuationList;
 	UDATA exclusiveAccessState;
 	omrthread_monitor_t classTableMutex;
 	UDATA anonClassCount;
@@ -5285,6 +5391,8 @@ typedef struct J9JavaVM {
 	UDATA thrMaxTryEnterYieldsBeforeBlocking;
 	UDATA thrNestedSpinning;
 	UDATA thrTryEnterNestedSpinning;
+	UDATA thrAdaptiveObjectMonitorSpin;
+	UDATA thrMembarrier;
 	UDATA thrDeflationPolicy;
 	UDATA gcOptions;
 	UDATA  ( *unhookVMEvent)(struct J9JavaVM *javaVM, UDATA eventNumber, void * currentHandler, void * oldHandler) ;
@@ -5327,6 +5435,7 @@ typedef struct J9JavaVM {
 	omrthread_monitor_t monitorTableMutex;
 	struct J9MonitorTableListEntry* monitorTableList;
 	struct J9Pool* monitorTableListPool;
+	j9objectmonitor_t* monitorTableLookupIndex;
 	UDATA thrStaggerStep;
 	UDATA thrStaggerMax;
 	UDATA thrStagger;
@@ -5445,6 +5554,8 @@ typedef struct J9JavaVM {
 	UDATA modulePointerOffset;
 	omrthread_monitor_t jniCriticalLock;
 	UDATA jniCriticalResponseCount;
+	U_64 exclusiveResponseHistogram[J9VM_EXCLUSIVE_RESPONSE_HISTOGRAM_SIZE];
+	struct J9ExclusiveVMAccessResponder exclusiveSlowestResponder;
 	struct J9SharedInvariantInternTable* sharedInvariantInternTable;
 	struct J9SharedCacheAPI* sharedCacheAPI;
 	UDATA lockwordMode;
@@ -5457,6 +5568,7 @@ typedef struct J9JavaVM {
 	void* originalSIGPIPESignalAction;
 	void* finalizeWorkerData;
 	j9object_t* heapOOMStringRef;
+	j9object_t* stackTraceDedupCacheRef;
 	UDATA strCompEnabled;
 	struct J9IdentityHashData* identityHashData;
 	UDATA minimumSuperclassArraySize;
@@ -5506,6 +5618,9 @@ typedef struct J9JavaVM {
 #if defined(J9UNIX) || defined(AIXPPC)
 	J9PortVmemIdentifier exclusiveGuardPage;
 	omrthread_monitor_t flushMutex;
+#if defined(LINUX)
+	UDATA flushUsesMembarrier;
+#endif /* LINUX */
 #elif defined(WIN32) /* J9UNIX || AIXPPC  */
 	void *flushFunction;
 #endif /* WIN32 */
@@ -315,6 +315,8 @@ enum INIT_STAGE {
 #define VMOPT_XNORTSJ "-Xnortsj"
 #define VMOPT_XXNOSTACKTRACEINTHROWABLE "-XX:-StackTraceInThrowable"
 #define VMOPT_XXSTACKTRACEINTHROWABLE "-XX:+StackTraceInThrowable"
+#define VMOPT_XXNODEDUPLICATESTACKTRACES "-XX:-DeduplicateStackTraces"
+#define VMOPT_XXDEDUPLICATESTACKTRACES "-XX:+DeduplicateStackTraces"
 #define VMOPT_XXNOPAGEALIGNDIRECTMEMORY "-XX:-PageAlignDirectMemory"
 #define VMOPT_XXPAGEALIGNDIRECTMEMORY   "-XX:+PageAlignDirectMemory"
 #define VMOPT_XXVMLOCKCLASSLOADERENABLE "-XX:+VMLockClassLoader"
@@ -185,8 +185,15 @@ typedef struct ByteDataWrapper {
 	U_16 privateOwnerID;	
 } ByteDataWrapper;
 
+/* Byte data is never longer than MAX_INT, so the top bit of dataLength marks a compressed payload.
+ * A compressed payload is a U_32 uncompressed length followed by the deflated bytes.
+ * The flag was introduced with cache generation 43 (OSCACHE_CURRENT_CACHE_GEN), so JVMs that would read
+ * the flag as part of the length never attach to a cache that may contain compressed byte data. */
+#define BDW_COMPRESSED_FLAG 0x80000000
+
 #define BDWITEM(bdw) (((U_8*)(bdw)) - sizeof(ShcItem))
-#define BDWLEN(bdw) J9SHR_READMEM((bdw)->dataLength)
+#define BDWLEN(bdw) (J9SHR_READMEM((bdw)->dataLength) & ~BDW_COMPRESSED_FLAG)
+#define BDWISCOMPRESSED(bdw) (BDW_COMPRESSED_FLAG == (J9SHR_READMEM((bdw)->dataLength) & BDW_COMPRESSED_FLAG))
 #define BDWTYPE(bdw)  J9SHR_READMEM((bdw)->dataType)
 #define BDWINPRIVATEUSE(bdw) J9SHR_READMEM((bdw)->inPrivateUse)
 #define BDWPRIVATEOWNERID(bdw) J9SHR_READMEM((bdw)->privateOwnerID)
@@ -60,7 +60,8 @@
 #define J9SHR_ATTACHED_DATA_TYPE_UNKNOWN  0
 #define J9SHR_ATTACHED_DATA_TYPE_JITPROFILE  1
 #define J9SHR_ATTACHED_DATA_TYPE_JITHINT  2
-#define J9SHR_ATTACHED_DATA_TYPE_MAX 2
+#define J9SHR_ATTACHED_DATA_TYPE_CLASSPROFILE  3
+#define J9SHR_ATTACHED_DATA_TYPE_MAX 3
 
 #define J9SHR_RUNTIMEFLAG_ENABLE_TIMESTAMP_CHECKS  1
 #define J9SHR_RUNTIMEFLAG_ENABLE_LOCAL_CACHEING  2
@@ -189,4 +190,8 @@
 #define J9SHR_MIN_JIT_ADJUSTED	0x8
 #define J9SHR_MAX_JIT_ADJUSTED	0x10
 
+/* Following flags control how a persistent cache file is mapped, see J9SharedCacheAPI.mmapFlags */
+#define J9SHR_MMAP_FLAG_HUGE_PAGES	0x1
+#define J9SHR_MMAP_FLAG_PREFAULT	0x2
+
 #endif /* SHCFLAGS_H */
@@ -2250,6 +2250,9 @@ fixVTables_forNormalRedefine(J9VMThread * currentThread, J9HashTable * classPair
 void
 flushClassLoaderReflectCache(J9VMThread * currentThread, J9HashTable * classPairs);
 
+void
+flushMethodLookupCaches(J9VMThread * currentThread);
+
 #ifdef J9VM_INTERP_NATIVE_SUPPORT
 void
 jitClassRedefineEvent(J9VMThread * currentThread, J9JVMTIHCRJitEventData * jitEventData, UDATA extensionsEnabled);
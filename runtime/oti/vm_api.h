@@ -868,6 +868,41 @@ setIllegalAccessErrorReceiverNotSameOrSubtypeOfCurrentClass(J9VMThread *vmStruct
 jint
 initializeHeapOOMMessage(J9VMThread *currentThread);
 
+/**
+ * Allocate the table of walkback arrays shared by exceptions with identical stack traces,
+ * if -XX:+DeduplicateStackTraces is in effect.
+ *
+ * @param currentThread[in] the current J9VMThread
+ *
+ * @return JNI_OK on success, JNI_ENOMEM if the table could not be allocated
+ */
+jint
+initializeStackTraceDedupCache(J9VMThread *currentThread);
+
+/**
+ * Find a walkback array, in the stack trace deduplication table, holding exactly the given frames.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param frames[in] the PCs cached by the stack walk
+ * @param frameCount[in] the number of frames
+ * @param shapeHash[out] the hash of the frames, to pass to cacheDeduplicatedStackTrace
+ *
+ * @return the matching walkback, or NULL if there is none
+ */
+j9object_t
+findDeduplicatedStackTrace(J9VMThread *currentThread, UDATA *frames, UDATA frameCount, UDATA *shapeHash);
+
+/**
+ * Add a newly filled in walkback array to the stack trace deduplication table, replacing
+ * any walkback with the same hash. The array must not be modified afterwards.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param walkback[in] the walkback array
+ * @param shapeHash[in] the hash returned by findDeduplicatedStackTrace
+ */
+void
+cacheDeduplicatedStackTrace(J9VMThread *currentThread, j9object_t walkback, UDATA shapeHash);
+
 /**
  * Error message helper for throwing IllegalAccessError when illegally accessing final fields.
  *
@@ -1209,6 +1244,89 @@ void JNICALL
 j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak);
 
 
+/**
+ * Return the JNI global and weak global reference slots cached by a thread to the VM-wide pools.
+ * Called when the thread is terminating. The caller must have VM access.
+ *
+ * @param vmThread[in] the J9VMThread whose caches are emptied
+ */
+void
+flushJNIGlobalRefCaches(J9VMThread *vmThread);
+
+/* ---------------- ContinuationHelpers.cpp ---------------- */
+
+/**
+ * Create a continuation with its own Java stack, holding only an end of stack frame.
+ *
+ * The collectors do not scan continuations yet: while a continuation is mounted the stack of
+ * its carrier is not scanned, and while it is unmounted its own stack is not scanned. VM access
+ * must be held from mount to unmount, and an unmounted stack must not hold object references.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param stackSize[in] the initial size of the stack, or 0 for the initial size of thread stacks
+ *
+ * @return the continuation, or NULL if it could not be allocated
+ */
+J9VMContinuation *
+createContinuation(J9VMThread *currentThread, UDATA stackSize);
+
+/**
+ * Free a continuation which is not mounted, and its stacks.
+ * The current thread must have VM access.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param continuation[in] the continuation
+ */
+void
+freeContinuation(J9VMThread *currentThread, J9VMContinuation *continuation);
+
+/**
+ * Free all the continuations left when the VM is shut down, once no Java threads remain.
+ *
+ * @param vm[in] the J9JavaVM
+ */
+void
+freeAllContinuations(J9JavaVM *vm);
+
+/**
+ * Mount a continuation on the current thread, which then runs on the stack of the
+ * continuation. The stack of the thread is saved in the continuation until it is unmounted.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param continuation[in] the continuation
+ *
+ * @return TRUE if the continuation was mounted, FALSE if the thread already has a mounted
+ * continuation or the continuation is mounted on another thread
+ */
+BOOLEAN
+mountContinuation(J9VMThread *currentThread, J9VMContinuation *continuation);
+
+/**
+ * Unmount the continuation mounted on the current thread, and restore the stack of the thread.
+ * Must be called with the same entry local storage as the matching mountContinuation, once
+ * the continuation has exited the monitors and popped the JNI reference frames it pushed.
+ *
+ * @param currentThread[in] the current J9VMThread
+ *
+ * @return the continuation, or NULL if none was mounted
+ */
+J9VMContinuation *
+unmountContinuation(J9VMThread *currentThread);
+
+/**
+ * Walk the stack saved in a continuation: the stack of the continuation while it is not
+ * mounted, or the stack of its carrier thread while it is mounted.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param continuation[in] the continuation
+ * @param walkState[in] the walk state, whose walkThread is set by this function
+ *
+ * @return the result of walkStackFrames
+ */
+UDATA
+walkContinuationStackFrames(J9VMThread *currentThread, J9VMContinuation *continuation, J9StackWalkState *walkState);
+
+
 /**
 * @brief
 * @param *env
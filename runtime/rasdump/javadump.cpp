@@ -341,6 +341,7 @@ private :
 	void        writeThreadsJavaOnly(void);
 	void        writeThreadTime              (const char * timerName, I_64 nanoTime);
 	void        writeThreadsUsageSummary     (void);
+	void        writeExclusiveResponseHistogram(void);
 	void        writeHookInfo                (struct OMRHookInfo4Dump *hookInfo);
 	void        writeHookInterface           (struct J9HookInterface **hookInterface);
 	/* Other internal methods */
@@ -2000,6 +2001,8 @@ JavaCoreDumpWriter::writeThreadSection(void)
 	_OutputStream.writeInteger(_VirtualMachine->daemonThreadCount, "%i");
 	_OutputStream.writeCharacters("\n");
 
+	writeExclusiveResponseHistogram();
+
 #if !defined(OSX)
 	/* if thread preempt is enabled, and we have the lock, then collect the native stacks */
 	if ((_Agent->requestMask & J9RAS_DUMP_DO_PREEMPT_THREADS) && _PreemptLocked
@@ -2069,6 +2072,47 @@ JavaCoreDumpWriter::writeThreadSection(void)
 	);
 }
 
+/**
+ * Write the histogram of the times threads took to respond to exclusive access requests,
+ * and the slowest responder to the current or last request.
+ */
+void
+JavaCoreDumpWriter::writeExclusiveResponseHistogram(void)
+{
+	J9ExclusiveVMAccessResponder *slowestResponder = &_VirtualMachine->exclusiveSlowestResponder;
+	UDATA bucket = 0;
+
+	_OutputStream.writeCharacters("NULL\n");
+	_OutputStream.writeCharacters(
+		"1XMEXCLRESP    Exclusive access response times:\n");
+	for (bucket = 0; bucket < J9VM_EXCLUSIVE_RESPONSE_HISTOGRAM_SIZE; bucket++) {
+		U_64 count = _VirtualMachine->exclusiveResponseHistogram[bucket];
+		if (0 != count) {
+			_OutputStream.writeCharacters("2XMEXCLRESPHIST    ");
+			if (0 == bucket) {
+				_OutputStream.writeCharacters("< 1 us");
+			} else if ((J9VM_EXCLUSIVE_RESPONSE_HISTOGRAM_SIZE - 1) == bucket) {
+				_OutputStream.writeInteger64((U_64)1 << (bucket - 1), ">= %llu us");
+			} else {
+				_OutputStream.writeInteger64((U_64)1 << (bucket - 1), "%llu");
+				_OutputStream.writeInteger64((U_64)1 << bucket, " - %llu us");
+			}
+			_OutputStream.writeInteger64(count, ": %llu\n");
+		}
+	}
+	if (NULL != slowestResponder->thread) {
+		_OutputStream.writeCharacters("2XMEXCLSLOWEST     Slowest responder to the last request: J9VMThread:");
+		_OutputStream.writePointer(slowestResponder->thread);
+		_OutputStream.writeInteger64(slowestResponder->responseTime, ", response time %llu us");
+		_OutputStream.writeInteger(slowestResponder->vmState, ", vmState 0x%zX");
+		if (NULL != slowestResponder->method) {
+			_OutputStream.writeCharacters(", top frame J9Method:");
+			_OutputStream.writePointer(slowestResponder->method);
+		}
+		_OutputStream.writeCharacters("\n");
+	}
+}
+
 void
 JavaCoreDumpWriter::writeThreadsUsageSummary(void)
 {
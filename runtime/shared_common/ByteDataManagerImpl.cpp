@@ -229,7 +229,7 @@ SH_ByteDataManagerImpl::findSingleEntry(J9VMThread* currentThread, const char* k
 					(dataType == (UDATA)(wrapper->dataType)) && 
 					(wrapper->privateOwnerID == jvmID)) {
 				if (dataLen) {
-					*dataLen = wrapper->dataLength;
+					*dataLen = BDWLEN(wrapper);
 				}
 				Trc_SHR_BDMI_findSingleEntry_ExitFound(currentThread, wrapper);
 				return wrapper;
@@ -282,12 +282,12 @@ SH_ByteDataManagerImpl::markAllStaleForKey(J9VMThread* currentThread, const char
 }
 
 void
-SH_ByteDataManagerImpl::setDescriptorFields(const ByteDataWrapper* wrapper, J9SharedDataDescriptor* descriptor)
+SH_ByteDataManagerImpl::setDescriptorFields(const ByteDataWrapper* wrapper, U_8* data, UDATA dataLen, J9SharedDataDescriptor* descriptor)
 {
 	Trc_SHR_BDMI_setDescriptorFields_Event(wrapper, descriptor);
 
-	descriptor->address = (U_8*)_cache->getDataFromByteDataWrapper(wrapper);
-	descriptor->length = wrapper->dataLength;
+	descriptor->address = data;
+	descriptor->length = dataLen;
 	descriptor->type = (UDATA)wrapper->dataType;
 	descriptor->flags = 0;
 	if (wrapper->privateOwnerID) {
@@ -340,14 +340,20 @@ SH_ByteDataManagerImpl::find(J9VMThread* currentThread, const char* key, UDATA k
 			if (!_cache->isStale(item) &&
 				(!limitDataType || (limitDataType == (UDATA)wrapper->dataType)) &&
 				(includePrivateData || (!includePrivateData && (wrapper->privateOwnerID == 0)))) {
-				if (descriptorPool && (newPoolEntry = (J9SharedDataDescriptor*)pool_newElement((J9Pool*)descriptorPool))) {
-					setDescriptorFields(wrapper, newPoolEntry);
+				UDATA dataLen = 0;
+				/* Compressed data is returned from a private copy inflated the first time it is found */
+				U_8* data = _cache->getUncompressedByteData(currentThread, wrapper, &dataLen);
+
+				if (NULL != data) {
+					if (descriptorPool && (newPoolEntry = (J9SharedDataDescriptor*)pool_newElement((J9Pool*)descriptorPool))) {
+						setDescriptorFields(wrapper, data, dataLen, newPoolEntry);
+					}
+					if (!setOptItem && firstItem) {
+						setDescriptorFields(wrapper, data, dataLen, firstItem);
+						setOptItem = TRUE;
+					}
+					++resultCntr;
 				}
-				if (!setOptItem && firstItem) {
-					setDescriptorFields(wrapper, firstItem);
-					setOptItem = TRUE;
-				}
-				++resultCntr;
 			} 
 			walk = (BdLinkedListImpl*)walk->_next;
 		} while (walk != found);
@@ -103,7 +103,7 @@ private:
 
 	void initialize(J9JavaVM* vm, SH_SharedCache* cache, BlockPtr memForConstructor);
 	
-	void setDescriptorFields(const ByteDataWrapper* wrapper, J9SharedDataDescriptor* descriptor);
+	void setDescriptorFields(const ByteDataWrapper* wrapper, U_8* data, UDATA dataLen, J9SharedDataDescriptor* descriptor);
 
 	static UDATA htReleasePrivateEntry(void *entry, void *opaque);
 	
@@ -36,6 +36,7 @@
 #include "j9shrnls.h"
 #include "j9comp.h"
 #include "j9consts.h"
+#include "zlib.h"
 #include <string.h>
 extern "C" {
 #include "shrinit.h"
@@ -88,6 +89,11 @@ static void checkROMClassUTF8SRPs(J9ROMClass *romClass);
 #define FIND_ATTACHED_DATA_RETRY_COUNT 1
 #define FIND_ATTACHED_DATA_CORRUPT_WAIT_TIME 1
 
+#define STARTUP_ACCESS_PROFILE_KEY_PREFIX "J9StartupPages:"
+#define STARTUP_ACCESS_PROFILE_KEY_LENGTH 32
+#define STARTUP_ACCESS_PROFILE_BITMAP(profile) ((U_32*)((profile) + 1))
+#define STARTUP_ACCESS_PROFILE_LENGTH(numPages) (sizeof(J9SharedStartupAccessProfile) + (J9SHR_STARTUP_ACCESS_BITMAP_WORDS(numPages) * sizeof(U_32)))
+
 struct TR_AOTHeader;
 
 /**
@@ -245,6 +251,164 @@ SH_CacheMap::dontNeedMetadata(J9VMThread* currentThread)
 
 }
 
+/**
+ * Build the key under which the startup access profile of a cache layer is stored
+ *
+ * @param [in] cache  The cache layer
+ * @param [out] buffer  The buffer to write the key into
+ * @param [in] bufferLength  The length of buffer
+ *
+ * @return The length of the key
+ */
+UDATA
+SH_CacheMap::getStartupAccessProfileKey(SH_CompositeCacheImpl* cache, char* buffer, UDATA bufferLength)
+{
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	return j9str_printf(PORTLIB, buffer, bufferLength, "%s%d", STARTUP_ACCESS_PROFILE_KEY_PREFIX, (I_32)cache->getLayer());
+}
+
+/**
+ * Find the startup access profile stored by a previous JVM for a cache layer
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] cache  The cache layer
+ *
+ * @return The profile, or NULL if there is none or it does not match the layout of the cache layer
+ */
+const J9SharedStartupAccessProfile*
+SH_CacheMap::findStartupAccessProfile(J9VMThread* currentThread, SH_CompositeCacheImpl* cache)
+{
+	J9SharedDataDescriptor descriptor;
+	char key[STARTUP_ACCESS_PROFILE_KEY_LENGTH];
+	UDATA keyLength = getStartupAccessProfileKey(cache, key, sizeof(key));
+
+	if (0 < findSharedData(currentThread, key, keyLength, J9SHR_DATA_TYPE_VM, FALSE, &descriptor, NULL)) {
+		const J9SharedStartupAccessProfile* profile = (const J9SharedStartupAccessProfile*)descriptor.address;
+
+		if ((descriptor.length == STARTUP_ACCESS_PROFILE_LENGTH(cache->getStartupAccessNumPages()))
+			&& (profile->pageSize == cache->getStartupAccessPageSize())
+			&& (profile->numPages == cache->getStartupAccessNumPages())
+		) {
+			return profile;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Advise the OS to read ahead the pages of each cache layer that previous JVMs accessed during startup,
+ * then start recording the pages accessed during the startup of this JVM.
+ *
+ * @param [in] currentThread  The current thread
+ */
+void
+SH_CacheMap::startStartupAccessProfile(J9VMThread* currentThread)
+{
+	SH_CompositeCacheImpl* ccToUse = _ccHead;
+	bool doRecord = J9_ARE_NO_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_READONLY);
+
+	do {
+		const J9SharedStartupAccessProfile* profile = findStartupAccessProfile(currentThread, ccToUse);
+
+		if (NULL != profile) {
+			UDATA pagesAdvised = ccToUse->prefetchStartupPages(currentThread, STARTUP_ACCESS_PROFILE_BITMAP(profile), profile->numPages);
+			Trc_SHR_CM_startStartupAccessProfile_Prefetched(currentThread, (I_32)ccToUse->getLayer(), pagesAdvised);
+		}
+		if (doRecord) {
+			ccToUse->startStartupAccessRecording(currentThread);
+		}
+		ccToUse = ccToUse->getNext();
+	} while (NULL != ccToUse);
+
+	_recordingStartupAccess = doRecord;
+}
+
+/**
+ * Stop recording startup accesses, and store the pages accessed in each cache layer so that the next
+ * JVM can read them ahead. The stored profile is the union of the pages accessed by this JVM and
+ * the existing profile, and is only written when this JVM accessed pages the existing profile does not have.
+ *
+ * @param [in] currentThread  The current thread
+ */
+void
+SH_CacheMap::storeStartupAccessProfile(J9VMThread* currentThread)
+{
+	SH_CompositeCacheImpl* ccToUse = _ccHead;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if (!_recordingStartupAccess) {
+		return;
+	}
+	_recordingStartupAccess = false;
+
+	do {
+		UDATA numPages = 0;
+		const U_32* accessed = ccToUse->stopStartupAccessRecording(currentThread, &numPages);
+
+		if (NULL != accessed) {
+			UDATA profileLength = STARTUP_ACCESS_PROFILE_LENGTH(numPages);
+			J9SharedStartupAccessProfile* profile = (J9SharedStartupAccessProfile*)j9mem_allocate_memory(profileLength, J9MEM_CATEGORY_CLASSES);
+
+			if (NULL != profile) {
+				const J9SharedStartupAccessProfile* existing = findStartupAccessProfile(currentThread, ccToUse);
+				const U_32* existingBitmap = (NULL == existing) ? NULL : STARTUP_ACCESS_PROFILE_BITMAP(existing);
+				U_32* bitmap = STARTUP_ACCESS_PROFILE_BITMAP(profile);
+				bool hasNewPages = false;
+
+				profile->pageSize = (U_32)ccToUse->getStartupAccessPageSize();
+				profile->numPages = (U_32)numPages;
+				for (UDATA i = 0; i < J9SHR_STARTUP_ACCESS_BITMAP_WORDS(numPages); i++) {
+					U_32 existingWord = (NULL == existingBitmap) ? 0 : existingBitmap[i];
+
+					if (0 != (accessed[i] & ~existingWord)) {
+						hasNewPages = true;
+					}
+					bitmap[i] = accessed[i] | existingWord;
+				}
+				if (hasNewPages) {
+					J9SharedDataDescriptor descriptor;
+					char key[STARTUP_ACCESS_PROFILE_KEY_LENGTH];
+					UDATA keyLength = getStartupAccessProfileKey(ccToUse, key, sizeof(key));
+
+					descriptor.address = (U_8*)profile;
+					descriptor.length = profileLength;
+					descriptor.type = J9SHR_DATA_TYPE_VM;
+					/* The profile has a fixed length for a layer, so an existing profile in the top layer is overwritten in place */
+					descriptor.flags = J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE_OVERWRITE;
+					const U_8* stored = storeSharedData(currentThread, key, keyLength, &descriptor);
+					Trc_SHR_CM_storeStartupAccessProfile_Stored(currentThread, (I_32)ccToUse->getLayer(), stored);
+				}
+				j9mem_free_memory(profile);
+			}
+		}
+		ccToUse = ccToUse->getNext();
+	} while (NULL != ccToUse);
+}
+
+/**
+ * Record an access to the ROMClass segment of the cache while the JVM is starting up
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] address  The start of the range accessed
+ * @param [in] length  The length of the range accessed
+ */
+void
+SH_CacheMap::recordStartupAccess(J9VMThread* currentThread, const void* address, UDATA length)
+{
+	SH_CompositeCacheImpl* ccToUse = _ccHead;
+
+	if (!_recordingStartupAccess) {
+		return;
+	}
+	do {
+		if (ccToUse->recordStartupAccess(currentThread, address, length)) {
+			break;
+		}
+		ccToUse = ccToUse->getNext();
+	} while (NULL != ccToUse);
+}
+
 /**
  * Builds a new SH_CacheMap for retrieving cache statistics
  *
@@ -289,6 +453,9 @@ SH_CacheMap::initialize(J9JavaVM* vm, J9SharedClassConfig* sharedClassConfig, Bl
 	_bytesRead = 0;
 	_isAssertEnabled = true;
 	_metadataReleased = false;
+	_recordingStartupAccess = false;
+	_inflatedByteData = NULL;
+	_inflatedByteDataMutex = NULL;
 	_ccPool = NULL;
 
 	_managers = SH_Managers::newInstance(vm, (SH_Managers *)allocPtr);
@@ -363,6 +530,7 @@ SH_CacheMap::cleanup(J9VMThread* currentThread)
 		walkManager->cleanup(currentThread);
 		walkManager = managers()->nextDo(&state);
 	}
+	_tsm->cleanup(currentThread);
 	while (theCC) {
 		SH_CompositeCacheImpl* nextCC = theCC->getNext();
 		theCC->cleanup(currentThread);
@@ -381,6 +549,15 @@ SH_CacheMap::cleanup(J9VMThread* currentThread)
 		omrthread_monitor_destroy(_refreshMutex);
 		_refreshMutex = NULL;
 	}
+	if (_inflatedByteData) {
+		hashTableForEachDo(_inflatedByteData, SH_CacheMap::ibdFreeFn, (void*)_portlib);
+		hashTableFree(_inflatedByteData);
+		_inflatedByteData = NULL;
+	}
+	if (_inflatedByteDataMutex) {
+		omrthread_monitor_destroy(_inflatedByteDataMutex);
+		_inflatedByteDataMutex = NULL;
+	}
 	if (_ccPool) {
 		pool_kill(_ccPool);
 	}
@@ -467,6 +644,11 @@ SH_CacheMap::startup(J9VMThread* currentThread, J9SharedClassPreinitConfig* pico
 		return -1;
 	}
 
+	if (omrthread_monitor_init(&_inflatedByteDataMutex, 0)) {
+		/* Compressed byte data cannot be found without this mutex, but the cache is otherwise usable */
+		_inflatedByteDataMutex = NULL;
+	}
+
 	/* _ccHead->startup will set the _actualSize to the real cache size */
 	U_32 cacheFileSize = 0;
 	bool doRetry = false;
@@ -1064,6 +1246,7 @@ SH_CacheMap::startManager(J9VMThread* currentThread, SH_Manager* manager)
 	/* If a known dataType, but the manager has not been started yet */
 	if ((manager != NULL) && (manager->getState() != MANAGER_STATE_STARTED)) {
 		IDATA rc;
+		UDATA itemCountHint = 0;
 		
 		/* If manager has been shut down, don't try to re-start it */
 		if (manager->getState() == MANAGER_STATE_SHUTDOWN) {
@@ -1076,13 +1259,16 @@ SH_CacheMap::startManager(J9VMThread* currentThread, SH_Manager* manager)
 			enterRefreshMutex(currentThread, "startManager");
 			doExitRefreshMutex = true;
 		}
-		rc = (manager->startup(currentThread, _runtimeFlags, _verboseFlags, _actualSize) != 0);
+		if ((NULL != _ccHead) && _ccHead->isStarted()) {
+			itemCountHint = _ccHead->getItemCountHint(getItemCountHintDataType(manager));
+		}
+		rc = (manager->startup(currentThread, _runtimeFlags, _verboseFlags, _actualSize, itemCountHint) != 0);
 
 		/* Manager either in wrong state to start or there was an error starting it */
 		while ((rc != -1) && (manager->getState() != MANAGER_STATE_STARTED)) {
 			/* Keep trying if it was in the wrong state */
 			omrthread_sleep(10);
-			rc = (manager->startup(currentThread, _runtimeFlags, _verboseFlags, _actualSize) != 0);
+			rc = (manager->startup(currentThread, _runtimeFlags, _verboseFlags, _actualSize, itemCountHint) != 0);
 		}
 		if (rc == -1) {
 			return -1;
@@ -1220,6 +1406,36 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 	return result;
 }
 
+/**
+ * Check whether a lookup can run without the cache read mutex, and if so start a lock-free read.
+ *
+ * This is the lock-free counterpart of runEntryPointChecks(). It fails, so that the caller takes the
+ * read mutex and runs runEntryPointChecks(), when the cache is locked or corrupt, when the address is
+ * not in the cache, or when there are cache updates to read into the local hashtables.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] address  An address that must be in the cache, or NULL
+ * @param [out] generation  The lock generation to pass to SH_CompositeCacheImpl::endLockFreeRead()
+ *
+ * @return true if the lookup may proceed without the read mutex
+ *
+ * THREADING: Can be called multi-threaded
+ */
+bool
+SH_CacheMap::startLockFreeRead(J9VMThread* currentThread, const void* address, UDATA* generation)
+{
+	if (!_ccHead->startLockFreeRead(currentThread, generation)) {
+		return false;
+	}
+	if (_ccHead->isCacheCorrupt()
+		|| ((NULL != address) && !isAddressInCache(address, 0, true, false))
+		|| (0 != _ccHead->checkUpdates(currentThread))
+	) {
+		return false;
+	}
+	return true;
+}
+
 /* THREADING: MUST be protected by cache write mutex - therefore single-threaded within this JVM */
 IDATA
 SH_CacheMap::checkForCrash(J9VMThread* currentThread, bool hasClassSegmentMutex)
@@ -2511,6 +2727,8 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 	SH_ROMClassManager* localRCM;
 	UDATA hash = 0;
 	bool useWriteHash = _ccHead->isUsingWriteHash();
+	UDATA generation = 0;
+	bool isLockFreeRead = false;
 
 	Trc_SHR_CM_findROMClass_Entry(currentThread, path, cp->getHelperID());
 	
@@ -2530,27 +2748,40 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 		}
 	}
 
-	/* THREADING: We enter read mutex here. Multiple readers can read concurrently.
-	 * Readers can also read at the same time as a writer is writing. The mutex therefore serves
-	 * to indicate to the writers when readers have finished reading, incase they want a lock.
+	/* Look up without the read mutex while no writer has the cache locked and there are no updates to read.
+	 * If a writer locks the cache during the lookup, the result is discarded and the lookup repeated below.
 	 */
-	if (_ccHead->enterReadMutex(currentThread, fnName) != 0) {
-		Trc_SHR_CM_findROMClass_FailedMutex(currentThread, path, cp->getHelperID());
-		Trc_SHR_CM_findROMClass_Exit_Null(currentThread);
-		return NULL;
+	if (startLockFreeRead(currentThread, NULL, &generation)) {
+		rc = localRCM->locateROMClass(currentThread, path, pathLen, cp, -1, confirmedEntries, cp->getHelperID(), NULL, partition, modContext, &locateResult);
+		isLockFreeRead = _ccHead->endLockFreeRead(currentThread, generation);
+		if (!isLockFreeRead) {
+			Trc_SHR_CM_findROMClass_LockFreeRetry(currentThread, path);
+		}
 	}
 
-	if (runEntryPointChecks(currentThread, NULL, NULL) == -1) {
-		_ccHead->exitReadMutex(currentThread, fnName);
-		/* trace event is at level 1 and trace exit message is at level 2 as per CMVC 155318/157683 */
-		Trc_SHR_CM_findROMClass_Exit_Null_Event(currentThread, path, cp->getHelperID());
-		Trc_SHR_CM_findROMClass_Exit_Null(currentThread);
-		return NULL;
-	}
+	if (!isLockFreeRead) {
+		/* THREADING: We enter read mutex here. Multiple readers can read concurrently.
+		 * Readers can also read at the same time as a writer is writing. The mutex therefore serves
+		 * to indicate to the writers when readers have finished reading, incase they want a lock.
+		 */
+		if (_ccHead->enterReadMutex(currentThread, fnName) != 0) {
+			Trc_SHR_CM_findROMClass_FailedMutex(currentThread, path, cp->getHelperID());
+			Trc_SHR_CM_findROMClass_Exit_Null(currentThread);
+			return NULL;
+		}
 
-	rc = localRCM->locateROMClass(currentThread, path, pathLen, cp, -1, confirmedEntries, cp->getHelperID(), NULL, partition, modContext, &locateResult);
-	if ((rc & LOCATE_ROMCLASS_RETURN_MARKED_ITEM_STALE) != LOCATE_ROMCLASS_RETURN_MARKED_ITEM_STALE) {
-		_ccHead->exitReadMutex(currentThread, fnName);
+		if (runEntryPointChecks(currentThread, NULL, NULL) == -1) {
+			_ccHead->exitReadMutex(currentThread, fnName);
+			/* trace event is at level 1 and trace exit message is at level 2 as per CMVC 155318/157683 */
+			Trc_SHR_CM_findROMClass_Exit_Null_Event(currentThread, path, cp->getHelperID());
+			Trc_SHR_CM_findROMClass_Exit_Null(currentThread);
+			return NULL;
+		}
+
+		rc = localRCM->locateROMClass(currentThread, path, pathLen, cp, -1, confirmedEntries, cp->getHelperID(), NULL, partition, modContext, &locateResult);
+		if ((rc & LOCATE_ROMCLASS_RETURN_MARKED_ITEM_STALE) != LOCATE_ROMCLASS_RETURN_MARKED_ITEM_STALE) {
+			_ccHead->exitReadMutex(currentThread, fnName);
+		}
 	}
 
 	/* If ROMClass was not found (non-error case), look to see if another JVM is trying to load the same class.
@@ -2726,6 +2957,7 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 		/* Call updateROMSegmentList() to ensure that heapAlloc of the romClass segment is always updated to include the returned romClass */
 		updateROMSegmentList(currentThread, omrthread_monitor_owned_by_self(currentThread->javaVM->classMemorySegments->segmentMutex) != 0);
 		updateBytesRead(returnVal->romSize);		/* This is kind of inaccurate as the strings are all external to the ROMClass */
+		recordStartupAccess(currentThread, returnVal, returnVal->romSize);
 		/* trace event is at level 1 and trace exit message is at level 2 as per CMVC 155318/157683 */
 		Trc_SHR_CM_findROMClass_Exit_Found_Event(currentThread, path, returnVal, locateResult.foundAtIndex, cp->getHelperID());
 		Trc_SHR_CM_findROMClass_Exit_Found(currentThread, path, returnVal, locateResult.foundAtIndex);
@@ -2763,7 +2995,11 @@ SH_CacheMap::addROMClassResourceToCache(J9VMThread* currentThread, const void* r
 		}
 		break;
 	case TYPE_ATTACHED_DATA:
-		if (0 != (*_runtimeFlags & RUNTIME_FLAGS_PREVENT_JIT_DATA_UPDATE)) {
+		if (J9SHR_ATTACHED_DATA_TYPE_CLASSPROFILE == resourceSubType) {
+			if (0 != (*_runtimeFlags & RUNTIME_FLAGS_PREVENT_BLOCK_DATA_UPDATE)) {
+				return NULL;
+			}
+		} else if (0 != (*_runtimeFlags & RUNTIME_FLAGS_PREVENT_JIT_DATA_UPDATE)) {
 			return NULL;
 		}
 		break;
@@ -2807,6 +3043,8 @@ SH_CacheMap::addROMClassResourceToCache(J9VMThread* currentThread, const void* r
 			(J9SHR_ATTACHED_DATA_TYPE_JITHINT == resourceSubType)
 		){
 			itemInCache = (ShcItem*)(cacheAreaForAllocate->allocateJIT(currentThread, itemPtr, dataLength));
+		} else if (J9SHR_ATTACHED_DATA_TYPE_CLASSPROFILE == resourceSubType) {
+			itemInCache = (ShcItem*)(cacheAreaForAllocate->allocateBlock(currentThread, itemPtr, align, wrapperLength));
 		}
 		break;
 	default :
@@ -3052,12 +3290,14 @@ SH_CacheMap::updateROMClassResource(J9VMThread* currentThread, const void* addre
  * THREADING: This function can be called multi-threaded.
  */
 const void*
-SH_CacheMap::findROMClassResource(J9VMThread* currentThread, const void* romAddress, SH_ROMClassResourceManager* localRRM, SH_ROMClassResourceManager::SH_ResourceDescriptor* resourceDescriptor, bool useReadMutex, const char** p_subcstr, UDATA* flags)
+SH_CacheMap::findROMClassResource(J9VMThread* currentThread, const void* romAddress, SH_ROMClassResourceManager* localRRM, SH_ROMClassResourceManager::SH_ResourceDescriptor* resourceDescriptor, bool useReadMutex, bool isLockFreeRead, const char** p_subcstr, UDATA* flags)
 {
 	const void* result = NULL;
 	const char* fnName = "findROMClassResource";
-	const void* resourceWrapper;
+	const void* resourceWrapper = NULL;
 	UDATA resourceKey;
+	UDATA generation = 0;
+	bool isInvalidated = false;
 
 	PORT_ACCESS_FROM_VMC(currentThread);
 	Trc_SHR_CM_findROMClassResource_Entry(currentThread, romAddress);
@@ -3070,27 +3310,56 @@ SH_CacheMap::findROMClassResource(J9VMThread* currentThread, const void* romAddr
 		return NULL;
 	}
 
-	if ((true == useReadMutex) && (_ccHead->enterReadMutex(currentThread, fnName) != 0)) {
-		if (NULL != p_subcstr) {
-			*p_subcstr = j9nls_lookup_message((J9NLS_INFO | J9NLS_DO_NOT_PRINT_MESSAGE_TAG), J9NLS_SHRC_CM_ENTER_READ_MUTEX, "enterReadMutex failed");
+	resourceKey = resourceDescriptor->generateKey(romAddress);
+
+	/* If the caller is reading without the read mutex, it has run the checks in startLockFreeRead() and validates the read itself */
+	if ((true == useReadMutex) && startLockFreeRead(currentThread, romAddress, &generation)) {
+		if ((resourceWrapper = localRRM->findResource(currentThread, resourceKey)) != 0) {
+			isInvalidated = (TYPE_INVALIDATED_COMPILED_METHOD == ITEMTYPE(resourceDescriptor->wrapperToItem(resourceWrapper)));
+		}
+		if (_ccHead->endLockFreeRead(currentThread, generation)) {
+			isLockFreeRead = true;
+		} else {
+			/* The cache was locked during the lookup, so repeat it holding the read mutex */
+			Trc_SHR_CM_findROMClassResource_LockFreeRetry(currentThread, romAddress);
+			resourceWrapper = NULL;
+			isInvalidated = false;
+		}
+	} else if (true == isLockFreeRead) {
+		if ((resourceWrapper = localRRM->findResource(currentThread, resourceKey)) != 0) {
+			isInvalidated = (TYPE_INVALIDATED_COMPILED_METHOD == ITEMTYPE(resourceDescriptor->wrapperToItem(resourceWrapper)));
 		}
-		Trc_SHR_CM_findROMClassResource_FailedMutex(currentThread, romAddress);
-		Trc_SHR_CM_findROMClassResource_ExitFailedMutex(currentThread, romAddress);
-		return NULL;
 	}
 
-	if (runEntryPointChecks(currentThread, (void*)romAddress, p_subcstr) == -1) {
+	if (false == isLockFreeRead) {
+		if ((true == useReadMutex) && (_ccHead->enterReadMutex(currentThread, fnName) != 0)) {
+			if (NULL != p_subcstr) {
+				*p_subcstr = j9nls_lookup_message((J9NLS_INFO | J9NLS_DO_NOT_PRINT_MESSAGE_TAG), J9NLS_SHRC_CM_ENTER_READ_MUTEX, "enterReadMutex failed");
+			}
+			Trc_SHR_CM_findROMClassResource_FailedMutex(currentThread, romAddress);
+			Trc_SHR_CM_findROMClassResource_ExitFailedMutex(currentThread, romAddress);
+			return NULL;
+		}
+
+		if (runEntryPointChecks(currentThread, (void*)romAddress, p_subcstr) == -1) {
+			if (true == useReadMutex) {
+				_ccHead->exitReadMutex(currentThread, fnName);
+			}
+			Trc_SHR_CM_findROMClassResource_Exit1(currentThread);
+			return NULL;
+		}
+
+		if ((resourceWrapper = localRRM->findResource(currentThread, resourceKey)) != 0) {
+			isInvalidated = (TYPE_INVALIDATED_COMPILED_METHOD == ITEMTYPE(resourceDescriptor->wrapperToItem(resourceWrapper)));
+		}
+
 		if (true == useReadMutex) {
 			_ccHead->exitReadMutex(currentThread, fnName);
 		}
-		Trc_SHR_CM_findROMClassResource_Exit1(currentThread);
-		return NULL;
 	}
 
-	resourceKey = resourceDescriptor->generateKey(romAddress);
-
-	if ((resourceWrapper = localRRM->findResource(currentThread, resourceKey)) != 0) {
-		if (TYPE_INVALIDATED_COMPILED_METHOD != ITEMTYPE(resourceDescriptor->wrapperToItem(resourceWrapper))) {
+	if (resourceWrapper) {
+		if (!isInvalidated) {
 			result = resourceDescriptor->unWrap(resourceWrapper);
 		} else {
 			/* found an invalidated AOT method */
@@ -3098,13 +3367,6 @@ SH_CacheMap::findROMClassResource(J9VMThread* currentThread, const void* romAddr
 				*flags |= J9SHR_AOT_METHOD_FLAG_INVALIDATED;
 			}
 		}
-	}
-
-	if (true == useReadMutex) {
-		_ccHead->exitReadMutex(currentThread, fnName);
-	}
-
-	if (resourceWrapper) {
 		updateBytesRead(resourceDescriptor->resourceLengthFromWrapper(resourceWrapper));
 	}
 	
@@ -3180,7 +3442,7 @@ SH_CacheMap::findCompiledMethod(J9VMThread* currentThread, const J9ROMMethod* ro
 		return NULL;
 	}
 
-	result = (const U_8*)findROMClassResource(currentThread, romMethod, localCMM, &descriptor, true, NULL, flags);
+	result = (const U_8*)findROMClassResource(currentThread, romMethod, localCMM, &descriptor, true, false, NULL, flags);
 	if (NULL != result) {
 #if !defined(J9ZOS390) && !defined(AIXPPC)
 		if (_metadataReleased
@@ -3274,7 +3536,8 @@ SH_CacheMap::storeAttachedData(J9VMThread* currentThread, const void* addressInC
 		return J9SHR_RESOURCE_STORE_ERROR;
 	}
 
-	if (localVerboseFlags  & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) {
+	/* Class profiles are keyed by a ROM class rather than a ROM method, and are not JIT data */
+	if ((localVerboseFlags & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) && (J9SHR_ATTACHED_DATA_TYPE_CLASSPROFILE != data->type)) {
 		char subcstr[VERBOSE_BUFFER_SIZE];
 		const char *pSubcstr = subcstr;
 		const char *pType = attachedTypeString(data->type);
@@ -3353,7 +3616,7 @@ SH_CacheMap::updateAttachedData(J9VMThread* currentThread, const void* addressIn
 		Trc_SHR_CM_updateAttachedData_Exit1(currentThread);
 		return J9SHR_RESOURCE_STORE_ERROR;
 	}
-	if (localVerboseFlags  & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) {
+	if ((localVerboseFlags & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) && (J9SHR_ATTACHED_DATA_TYPE_CLASSPROFILE != data->type)) {
 		char subcstr[VERBOSE_BUFFER_SIZE];
 		const char* pSubcstr = subcstr;
 		const char *pType = attachedTypeString(data->type);
@@ -3431,7 +3694,7 @@ SH_CacheMap::updateAttachedUDATA(J9VMThread* currentThread, const void* addressI
 	data.length = sizeof(UDATA);
 	data.type = type;
 
-	if (localVerboseFlags  & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) {
+	if ((localVerboseFlags & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) && (J9SHR_ATTACHED_DATA_TYPE_CLASSPROFILE != type)) {
 		char subcstr[VERBOSE_BUFFER_SIZE];
 		const char* pSubcstr = subcstr;
 		const char *pType = attachedTypeString(data.type);
@@ -3496,7 +3759,7 @@ SH_CacheMap::findAttachedDataAPI(J9VMThread* currentThread, const void* addressI
 
 	Trc_SHR_CM_findAttachedDataAPI_Entry(currentThread, addressInCache, addressInCache);
 
-	if (localVerboseFlags  & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) {
+	if ((localVerboseFlags & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) && (J9SHR_ATTACHED_DATA_TYPE_CLASSPROFILE != data->type)) {
 		char subcstr[VERBOSE_BUFFER_SIZE];
 		const char* pSubcstr = subcstr;
 		subcstr[0] = 0;
@@ -3544,7 +3807,7 @@ SH_CacheMap::findAttachedData(J9VMThread* currentThread, const void* addressInCa
 	const U_8* result;
 	const char* fnName = "findAttachedData";
 	SH_AttachedDataManager* localADM ;
-	bool bufferAllocated = false;
+	UDATA generation = 0;
 	PORT_ACCESS_FROM_VMC(currentThread);
 
 	/* set the value to non-corrupt to prevent incorrect interpretation when NULL is returned due to some other error */
@@ -3556,6 +3819,25 @@ SH_CacheMap::findAttachedData(J9VMThread* currentThread, const void* addressInCa
 		return NULL;
 	}
 
+	if (startLockFreeRead(currentThread, addressInCache, &generation)) {
+		U_8* callerAddress = data->address;
+		UDATA callerLength = data->length;
+
+		result = readAttachedData(currentThread, localADM, addressInCache, data, corruptOffset, p_subcstr, true);
+		if (_ccHead->endLockFreeRead(currentThread, generation)) {
+			Trc_SHR_CM_findAttachedData_Exit3(currentThread, result);
+			return result;
+		}
+		/* The cache was locked while copying the data, so discard the copy and read again holding the read mutex */
+		Trc_SHR_CM_findAttachedData_LockFreeRetry(currentThread, addressInCache);
+		if (data->address != callerAddress) {
+			j9mem_free_memory(data->address);
+		}
+		data->address = callerAddress;
+		data->length = callerLength;
+		*corruptOffset = -1;
+	}
+
 	if (_ccHead->enterReadMutex(currentThread, fnName) != 0) {
 		if (NULL != p_subcstr) {
 			*p_subcstr = j9nls_lookup_message((J9NLS_INFO | J9NLS_DO_NOT_PRINT_MESSAGE_TAG), J9NLS_SHRC_CM_ENTER_READ_MUTEX, "enterReadMutex failed");
@@ -3564,8 +3846,37 @@ SH_CacheMap::findAttachedData(J9VMThread* currentThread, const void* addressInCa
 		return NULL;
 	}
 
+	result = readAttachedData(currentThread, localADM, addressInCache, data, corruptOffset, p_subcstr, false);
+
+	_ccHead->exitReadMutex(currentThread, fnName);
+	Trc_SHR_CM_findAttachedData_Exit3(currentThread, result);
+	return result;
+}
+
+/**
+ * Copy the attached data for addressInCache into data.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] localADM  The attached data manager
+ * @param [in] addressInCache  The address the data is attached to
+ * @param [in,out] data  Describes the data to find and receives the data found
+ * @param [out] corruptOffset  Set to the corrupt offset of the data found, or -1
+ * @param [out] p_subcstr  Set to a message describing a failure (optional)
+ * @param [in] isLockFreeRead  True if the caller does not hold the read mutex and validates the read with endLockFreeRead()
+ *
+ * @return The data copied, or NULL or a J9SHR_RESOURCE_ error value
+ *
+ * THREADING: Called with the read mutex held, or between startLockFreeRead() and endLockFreeRead()
+ */
+const U_8*
+SH_CacheMap::readAttachedData(J9VMThread* currentThread, SH_AttachedDataManager* localADM, const void* addressInCache, J9SharedDataDescriptor* data, IDATA *corruptOffset, const char** p_subcstr, bool isLockFreeRead)
+{
+	const U_8* result;
+	bool bufferAllocated = false;
+	PORT_ACCESS_FROM_VMC(currentThread);
+
 	SH_AttachedDataManager::SH_AttachedDataResourceDescriptor descriptor(NULL, 0, (U_16)data->type);
-	result = (const U_8*)findROMClassResource(currentThread, addressInCache, localADM, &descriptor, false, p_subcstr, NULL);
+	result = (const U_8*)findROMClassResource(currentThread, addressInCache, localADM, &descriptor, false, isLockFreeRead, p_subcstr, NULL);
 	if (NULL != result) {
 		I_32 corrupt;
 		U_32 wrapperLength, dataLength;
@@ -3679,8 +3990,6 @@ _exitWithError:
 		data->address = NULL;
 	}
 _exit:
-	_ccHead->exitReadMutex(currentThread, fnName);
-	Trc_SHR_CM_findAttachedData_Exit3(currentThread, result);
 	return result;
 }
 
@@ -3695,7 +4004,7 @@ _exit:
  */
 SH_CacheMap::BlockPtr
 SH_CacheMap::addByteDataToCache(J9VMThread* currentThread, SH_Manager* localBDM, const J9UTF8* tokenKeyInCache, 
-		const J9SharedDataDescriptor* data, SH_CompositeCacheImpl* forceCache, bool writeWithoutMetadata)
+		const J9SharedDataDescriptor* data, SH_CompositeCacheImpl* forceCache, bool writeWithoutMetadata, bool isCompressed)
 {
 	U_32 wrapperLength;
 	ByteDataWrapper* bdwInCache = NULL;
@@ -3785,6 +4094,9 @@ SH_CacheMap::addByteDataToCache(J9VMThread* currentThread, SH_Manager* localBDM,
 		}
 		bdwInCache = (ByteDataWrapper*)ITEMDATA(itemInCache);
 		bdwInCache->dataLength = (U_32)data->length;
+		if (isCompressed) {
+			bdwInCache->dataLength |= BDW_COMPRESSED_FLAG;
+		}
 		getJ9ShrOffsetFromAddress(tokenKeyToUse, &bdwInCache->tokenOffset);
 		if (externalBlock) {
 			getJ9ShrOffsetFromAddress(externalBlock, &bdwInCache->externalBlockOffset);
@@ -3922,7 +4234,7 @@ SH_CacheMap::storeSharedData(J9VMThread* currentThread, const char* key, UDATA k
 				Trc_SHR_Assert_True(NULL != bdwInCache);
 			}
 			if (NULL != bdwInCache) {
-				result = (const U_8*)getDataFromByteDataWrapper(bdwInCache);
+				result = (const U_8*)getUncompressedByteData(currentThread, bdwInCache, &foundDatalen);
 				if (data->address == NULL) {
 					/* We're being asked to allocate memory that has already been allocated */
 					if (data->flags & J9SHRDATA_ALLOCATE_ZEROD_MEMORY) {
@@ -3957,7 +4269,7 @@ SH_CacheMap::storeSharedData(J9VMThread* currentThread, const char* key, UDATA k
 						/* We've already got the data for our key/type, so return it */
 						Trc_SHR_CM_storeSharedData_FoundExisting(currentThread);
 						goto _done;
-					} else if (data->length == foundDatalen) {
+					} else if ((NULL != result) && (data->length == foundDatalen)) {
 						/* Only return the data if is an exact byte match */
 						if (memcmp(data->address, result, foundDatalen)==0) {
 							Trc_SHR_CM_storeSharedData_FoundExisting(currentThread);
@@ -4004,7 +4316,25 @@ _addData:
 				}
 			}
 		}
-		result = (const U_8*)addByteDataToCache(currentThread, localBDM, tokenKey, data, NULL, false);
+		J9SharedDataDescriptor compressedData;
+
+		if (compressByteData(currentThread, data, &compressedData)) {
+			result = (const U_8*)addByteDataToCache(currentThread, localBDM, tokenKey, &compressedData, NULL, false, true);
+			j9mem_free_memory(compressedData.address);
+			if (NULL != result) {
+				/* Callers expect to get back the data they stored, so keep an uncompressed copy for this JVM */
+				const ByteDataWrapper* bdwAdded = (const ByteDataWrapper*)(result - sizeof(ByteDataWrapper));
+				U_8* copy = (U_8*)j9mem_allocate_memory(data->length, J9MEM_CATEGORY_CLASSES);
+
+				result = NULL;
+				if (NULL != copy) {
+					memcpy(copy, data->address, data->length);
+					result = storeInflatedByteData(currentThread, bdwAdded, copy, data->length);
+				}
+			}
+		} else {
+			result = (const U_8*)addByteDataToCache(currentThread, localBDM, tokenKey, data, NULL, false, false);
+		}
 	}
 
 _done:
@@ -4278,6 +4608,9 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 				descriptor->jitHintDataBytes += _adm->getDataBytesForType(type);
 				descriptor->numJitHints += _adm->getNumOfType(type);
 				break;
+			case J9SHR_ATTACHED_DATA_TYPE_CLASSPROFILE:
+				/* counted in otherBytes */
+				break;
 			default:
 				Trc_SHR_CM_getJavacoreData_InvalidAttachedDataType(type);
 				Trc_SHR_Assert_ShouldNeverHappen();
@@ -4490,7 +4823,10 @@ SH_CacheMap::markItemStaleCheckMutex(J9VMThread* currentThread, const ShcItem* i
 		}
 		_ccHead->markStale(currentThread, (BlockPtr)ITEMEND(item), true);
 	} else {
-		_ccHead->exitReadMutex(currentThread, fnName);
+		/* A lock-free lookup does not hold the read mutex */
+		if (_ccHead->hasReadMutex(currentThread)) {
+			_ccHead->exitReadMutex(currentThread, fnName);
+		}
 		if (_ccHead->enterWriteMutex(currentThread, true, fnName) == 0) {
 			_ccHead->markStale(currentThread, (BlockPtr)ITEMEND(item), true);
 			_ccHead->exitWriteMutex(currentThread, fnName);
@@ -5239,6 +5575,8 @@ SH_CacheMap::printShutdownStats(void)
 	U_32 softmxUnstoredBytes = 0;
 	U_32 maxAOTUnstoredBytes = 0;
 	U_32 maxJITUnstoredBytes = 0;
+	UDATA timestampsChecked = 0;
+	UDATA timestampsAvoided = 0;
 	SH_CompositeCacheImpl* cache = _ccHead;
 	PORT_ACCESS_FROM_PORT(_portlib);
 
@@ -5250,6 +5588,10 @@ SH_CacheMap::printShutdownStats(void)
 	
 	CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_READ_STORED, bytesRead, bytesStored);
 	CACHEMAP_TRACE3(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_UNSTORED_V1, softmxUnstoredBytes, maxAOTUnstoredBytes, maxJITUnstoredBytes);
+	_tsm->getTimestampCheckCounts(&timestampsChecked, &timestampsAvoided);
+	if (0 != (timestampsChecked + timestampsAvoided)) {
+		CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_TIMESTAMP_CHECKS, timestampsChecked, timestampsAvoided);
+	}
 }
 
 /**
@@ -5267,6 +5609,10 @@ SH_CacheMap::runExitCode(J9VMThread* currentThread)
 	walkManager = managers()->startDo(currentThread, 0, &state);
 	while (walkManager) {
 		walkManager->runExitCode();
+		if (NULL != _ccHead) {
+			/* Record how many items each manager indexed so that the next JVM can size its hashtables to match */
+			_ccHead->setItemCountHint(getItemCountHintDataType(walkManager), walkManager->getHashTableEntryCount());
+		}
 		walkManager = managers()->nextDo(&state);
 	}
 	
@@ -5276,6 +5622,26 @@ SH_CacheMap::runExitCode(J9VMThread* currentThread)
 	}
 }
 
+/**
+ * Return the data type under which the item count of a manager is persisted in the cache header.
+ *
+ * @param[in] manager  The manager
+ *
+ * @return The data type, or TYPE_UNINITIALIZED if no count is persisted for this manager
+ */
+UDATA /*static */
+SH_CacheMap::getItemCountHintDataType(SH_Manager* manager)
+{
+	static const UDATA hintedTypes[] = { TYPE_ROMCLASS, TYPE_CLASSPATH, TYPE_COMPILED_METHOD, TYPE_BYTE_DATA, TYPE_ATTACHED_DATA };
+
+	for (UDATA i = 0; i < (sizeof(hintedTypes) / sizeof(hintedTypes[0])); i++) {
+		if (manager->isDataTypeRepresended(hintedTypes[i])) {
+			return hintedTypes[i];
+		}
+	}
+	return TYPE_UNINITIALIZED;
+}
+
 /* Note: className can be NULL and if not, is not necessarily null-terminated */
 /* THREADING: Can be called multi-threaded */
 IDATA /*static */
@@ -6045,6 +6411,8 @@ SH_CacheMap::attachedTypeString(UDATA type)
 		return "JITPROFILE";
 	case J9SHR_ATTACHED_DATA_TYPE_JITHINT:
 		return "JITHINT";
+	case J9SHR_ATTACHED_DATA_TYPE_CLASSPROFILE:
+		return "CLASSPROFILE";
 	default:
 		Trc_SHR_CM_attachedTypeString_Error(type);
 		Trc_SHR_Assert_ShouldNeverHappen();
@@ -7048,3 +7416,197 @@ SH_CacheMap::getDataFromByteDataWrapper(const ByteDataWrapper* bdw)
 	}
 	return ret;
 }
+
+/**
+ *	Get the byte data given the ByteDataWrapper, inflating it if it was stored compressed.
+ *	Inflated data is kept for the lifetime of this JVM's attachment to the cache, so it is only inflated once.
+ *
+ *	@param [in] currentThread The current thread
+ *	@param [in] bdw A ByteDataWrapper
+ *	@param [out] dataLen The length of the data returned
+ *
+ *	@return The uncompressed data, or NULL if compressed data could not be inflated
+ *
+ *	THREADING: Can be called multi-threaded
+ */
+U_8*
+SH_CacheMap::getUncompressedByteData(J9VMThread* currentThread, const ByteDataWrapper* bdw, UDATA* dataLen)
+{
+	U_8* data = getDataFromByteDataWrapper(bdw);
+	InflatedByteData query;
+	InflatedByteData* found = NULL;
+	U_8* result = NULL;
+	U_8* buffer = NULL;
+	U_32 inflatedLen = 0;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if (!BDWISCOMPRESSED(bdw)) {
+		*dataLen = BDWLEN(bdw);
+		return data;
+	}
+	if (NULL == _inflatedByteDataMutex) {
+		Trc_SHR_CM_getUncompressedByteData_Failed(currentThread, bdw);
+		return NULL;
+	}
+
+	query.wrapper = bdw;
+	omrthread_monitor_enter(_inflatedByteDataMutex);
+	if (NULL != _inflatedByteData) {
+		found = (InflatedByteData*)hashTableFind(_inflatedByteData, &query);
+		if (NULL != found) {
+			result = found->data;
+			*dataLen = found->length;
+		}
+	}
+	omrthread_monitor_exit(_inflatedByteDataMutex);
+	if (NULL != result) {
+		return result;
+	}
+
+	/* The compressed payload starts with the uncompressed length */
+	memcpy(&inflatedLen, data, sizeof(U_32));
+	if (0 != inflatedLen) {
+		buffer = (U_8*)j9mem_allocate_memory(inflatedLen, J9MEM_CATEGORY_CLASSES);
+	}
+	if (NULL != buffer) {
+		uLongf destLen = (uLongf)inflatedLen;
+
+		if ((Z_OK == uncompress(buffer, &destLen, data + sizeof(U_32), (uLong)(BDWLEN(bdw) - sizeof(U_32))))
+			&& (destLen == (uLongf)inflatedLen)
+		) {
+			result = storeInflatedByteData(currentThread, bdw, buffer, inflatedLen);
+		} else {
+			j9mem_free_memory(buffer);
+		}
+	}
+	if (NULL == result) {
+		Trc_SHR_CM_getUncompressedByteData_Failed(currentThread, bdw);
+		return NULL;
+	}
+
+	Trc_SHR_CM_getUncompressedByteData_Inflated(currentThread, bdw, (UDATA)inflatedLen);
+	*dataLen = inflatedLen;
+	return result;
+}
+
+/**
+ *	Record an uncompressed copy of the byte data for a ByteDataWrapper.
+ *	If another thread has already recorded a copy, data is freed and the existing copy is returned.
+ *
+ *	@param [in] currentThread The current thread
+ *	@param [in] bdw The ByteDataWrapper of the compressed data
+ *	@param [in] data Memory allocated from the port library holding the uncompressed data. Ownership passes to this function.
+ *	@param [in] dataLen The length of data
+ *
+ *	@return The recorded copy, or NULL if it could not be recorded
+ */
+U_8*
+SH_CacheMap::storeInflatedByteData(J9VMThread* currentThread, const ByteDataWrapper* bdw, U_8* data, UDATA dataLen)
+{
+	InflatedByteData entry;
+	InflatedByteData* stored = NULL;
+	U_8* result = NULL;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	entry.wrapper = bdw;
+	entry.data = data;
+	entry.length = dataLen;
+
+	if (NULL != _inflatedByteDataMutex) {
+		omrthread_monitor_enter(_inflatedByteDataMutex);
+		if (NULL == _inflatedByteData) {
+			_inflatedByteData = hashTableNew(OMRPORT_FROM_J9PORT(_portlib), J9_GET_CALLSITE(), 16, sizeof(InflatedByteData), sizeof(char *), 0, J9MEM_CATEGORY_CLASSES, SH_CacheMap::ibdHashFn, SH_CacheMap::ibdHashEqualFn, NULL, NULL);
+		}
+		if (NULL != _inflatedByteData) {
+			stored = (InflatedByteData*)hashTableAdd(_inflatedByteData, &entry);
+		}
+		if (NULL != stored) {
+			result = stored->data;
+		}
+		omrthread_monitor_exit(_inflatedByteDataMutex);
+	}
+
+	if (result != data) {
+		j9mem_free_memory(data);
+	}
+	return result;
+}
+
+/**
+ *	Compress byte data before it is stored, if -Xshareclasses:compressByteData=<size> applies to it.
+ *	Only public, indexed application (JCL) data is compressed. Other byte data is read in place by the JVM and JIT.
+ *
+ *	@param [in] currentThread The current thread
+ *	@param [in] data The data to be stored
+ *	@param [out] compressed Set to describe the compressed payload. The caller must free compressed->address.
+ *
+ *	@return true if data was compressed, false if it should be stored as is
+ */
+bool
+SH_CacheMap::compressByteData(J9VMThread* currentThread, const J9SharedDataDescriptor* data, J9SharedDataDescriptor* compressed)
+{
+	UDATA minBytes = currentThread->javaVM->sharedCacheAPI->compressByteDataMinBytes;
+	uLongf compressedLen = 0;
+	U_8* buffer = NULL;
+	U_32 uncompressedLen = 0;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if ((0 == minBytes)
+		|| (data->length < minBytes)
+		|| (NULL == data->address)
+		|| (J9SHR_DATA_TYPE_JCL != data->type)
+		|| J9_ARE_ANY_BITS_SET(data->flags, J9SHRDATA_IS_PRIVATE | J9SHRDATA_ALLOCATE_ZEROD_MEMORY | J9SHRDATA_USE_READWRITE | J9SHRDATA_NOT_INDEXED
+				| J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE | J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE_OVERWRITE)
+	) {
+		return false;
+	}
+
+	compressedLen = compressBound((uLong)data->length);
+	buffer = (U_8*)j9mem_allocate_memory(sizeof(U_32) + compressedLen, J9MEM_CATEGORY_CLASSES);
+	if (NULL == buffer) {
+		return false;
+	}
+	if ((Z_OK != compress2(buffer + sizeof(U_32), &compressedLen, data->address, (uLong)data->length, Z_DEFAULT_COMPRESSION))
+		|| ((sizeof(U_32) + compressedLen) >= data->length)
+	) {
+		/* Data that does not get smaller is stored uncompressed */
+		j9mem_free_memory(buffer);
+		return false;
+	}
+
+	uncompressedLen = (U_32)data->length;
+	memcpy(buffer, &uncompressedLen, sizeof(U_32));
+	compressed->address = buffer;
+	compressed->length = sizeof(U_32) + compressedLen;
+	compressed->type = data->type;
+	compressed->flags = data->flags;
+
+	Trc_SHR_CM_compressByteData_Compressed(currentThread, data->length, compressed->length);
+	return true;
+}
+
+UDATA
+SH_CacheMap::ibdHashFn(void* item, void *userData)
+{
+	InflatedByteData* entry = (InflatedByteData*)item;
+
+	return ((UDATA)entry->wrapper) >> 3;
+}
+
+UDATA
+SH_CacheMap::ibdHashEqualFn(void* left, void* right, void *userData)
+{
+	InflatedByteData* leftEntry = (InflatedByteData*)left;
+	InflatedByteData* rightEntry = (InflatedByteData*)right;
+
+	return leftEntry->wrapper == rightEntry->wrapper;
+}
+
+UDATA
+SH_CacheMap::ibdFreeFn(void* entry, void* userData)
+{
+	PORT_ACCESS_FROM_PORT((J9PortLibrary*)userData);
+
+	j9mem_free_memory(((InflatedByteData*)entry)->data);
+	return FALSE;
+}
@@ -70,6 +70,23 @@ typedef struct CacheAddressRange {
 	void* cacheEnd;
 } CacheAddressRange;
 
+/* The pages of a cache layer accessed during startup, stored in the cache as byte data.
+ * The header is followed by J9SHR_STARTUP_ACCESS_BITMAP_WORDS(numPages) U_32 words, with one bit per page.
+ */
+typedef struct J9SharedStartupAccessProfile {
+	U_32 pageSize;
+	U_32 numPages;
+} J9SharedStartupAccessProfile;
+
+/* A private copy of compressed byte data, inflated the first time this JVM finds it.
+ * The copy lives until the JVM detaches from the cache, so descriptors returned by findSharedData stay valid.
+ */
+typedef struct InflatedByteData {
+	const ByteDataWrapper* wrapper;
+	U_8* data;
+	UDATA length;
+} InflatedByteData;
+
 /* 
  * Implementation of SH_SharedCache interface
  */
@@ -133,6 +150,10 @@ public:
 
 	void dontNeedMetadata(J9VMThread* currentThread);
 
+	void startStartupAccessProfile(J9VMThread* currentThread);
+
+	void storeStartupAccessProfile(J9VMThread* currentThread);
+
 	/**
 	 * This function is extremely hot.
 	 * Peeks to see whether compiled code exists for a given ROMMethod in the CompiledMethodManager hashtable
@@ -223,6 +244,9 @@ public:
 	/* @see CacheMapStats.hpp */
 	U_8* getDataFromByteDataWrapper(const ByteDataWrapper* bdw);
 
+	/* @see SharedCache.hpp */
+	U_8* getUncompressedByteData(J9VMThread* currentThread, const ByteDataWrapper* bdw, UDATA* dataLen);
+
 
 	//New Functions To Support New ROM Class Builder
 	IDATA startClassTransaction(J9VMThread* currentThread, bool lockCache, const char* caller);
@@ -321,6 +345,9 @@ private:
 	U_32 _actualSize;
 	J9Pool* _ccPool;
 	bool _metadataReleased;
+	bool _recordingStartupAccess;
+	J9HashTable* _inflatedByteData;
+	omrthread_monitor_t _inflatedByteDataMutex;
 
 	bool _isAssertEnabled; /* flag to turn on/off assertion before acquiring local mutex */
 	
@@ -340,7 +367,7 @@ private:
 
 	const void* addROMClassResourceToCache(J9VMThread* currentThread, const void* romAddress, SH_ROMClassResourceManager* localRRM, SH_ROMClassResourceManager::SH_ResourceDescriptor* resourceDescriptor, const char** p_subcstr);
 
-	BlockPtr addByteDataToCache(J9VMThread* currentThread, SH_Manager* localBDM, const J9UTF8* tokenKeyInCache, const J9SharedDataDescriptor* data, SH_CompositeCacheImpl* forceCache, bool writeWithoutMetadata);
+	BlockPtr addByteDataToCache(J9VMThread* currentThread, SH_Manager* localBDM, const J9UTF8* tokenKeyInCache, const J9SharedDataDescriptor* data, SH_CompositeCacheImpl* forceCache, bool writeWithoutMetadata, bool isCompressed);
 
 	J9MemorySegment* addNewROMImageSegment(J9VMThread* currentThread, U_8* segmentBase, U_8* segmentEnd);
 	
@@ -348,12 +375,14 @@ private:
 
 	const void* storeROMClassResource(J9VMThread* currentThread, const void* romAddress, SH_ROMClassResourceManager* localRRM, SH_ROMClassResourceManager::SH_ResourceDescriptor* resourceDescriptor, UDATA forceReplace, const char** p_subcstr);
 
-	const void* findROMClassResource(J9VMThread* currentThread, const void* romAddress, SH_ROMClassResourceManager* localRRM, SH_ROMClassResourceManager::SH_ResourceDescriptor* resourceDescriptor, bool useReadMutex, const char** p_subcstr, UDATA* flags);
+	const void* findROMClassResource(J9VMThread* currentThread, const void* romAddress, SH_ROMClassResourceManager* localRRM, SH_ROMClassResourceManager::SH_ResourceDescriptor* resourceDescriptor, bool useReadMutex, bool isLockFreeRead, const char** p_subcstr, UDATA* flags);
 
 	UDATA updateROMClassResource(J9VMThread* currentThread, const void* addressInCache, I_32 updateAtOffset, SH_ROMClassResourceManager* localRRM, SH_ROMClassResourceManager::SH_ResourceDescriptor* resourceDescriptor, const J9SharedDataDescriptor* data, bool isUDATA, const char** p_subcstr);
 
 	const U_8* findAttachedData(J9VMThread* currentThread, const void* addressInCache, J9SharedDataDescriptor* data, IDATA *corruptOffset, const char** p_subcstr) ;
 
+	const U_8* readAttachedData(J9VMThread* currentThread, SH_AttachedDataManager* localADM, const void* addressInCache, J9SharedDataDescriptor* data, IDATA *corruptOffset, const char** p_subcstr, bool isLockFreeRead);
+
 	void updateROMSegmentList(J9VMThread* currentThread, bool hasClassSegmentMutex, bool topLayerOnly = true);
 
 	void updateROMSegmentListForCache(J9VMThread* currentThread, SH_CompositeCacheImpl* forCache);
@@ -386,6 +415,24 @@ private:
 	void updateAllManagersWithNewCacheArea(J9VMThread* currentThread, SH_CompositeCacheImpl* newArea);
 
 	void updateAccessedShrCacheMetadataBounds(J9VMThread* currentThread, uintptr_t const  * result);
+
+	void recordStartupAccess(J9VMThread* currentThread, const void* address, UDATA length);
+
+	UDATA getStartupAccessProfileKey(SH_CompositeCacheImpl* cache, char* buffer, UDATA bufferLength);
+
+	const J9SharedStartupAccessProfile* findStartupAccessProfile(J9VMThread* currentThread, SH_CompositeCacheImpl* cache);
+
+	bool startLockFreeRead(J9VMThread* currentThread, const void* address, UDATA* generation);
+
+	bool compressByteData(J9VMThread* currentThread, const J9SharedDataDescriptor* data, J9SharedDataDescriptor* compressed);
+
+	U_8* storeInflatedByteData(J9VMThread* currentThread, const ByteDataWrapper* bdw, U_8* data, UDATA dataLen);
+
+	static UDATA ibdHashFn(void* item, void *userData);
+
+	static UDATA ibdHashEqualFn(void* left, void* right, void *userData);
+
+	static UDATA ibdFreeFn(void* entry, void* userData);
 	
 	bool isAddressInReleasedMetaDataBounds(J9VMThread* currentThread, UDATA address) const;
 
@@ -393,6 +440,8 @@ private:
 
 	IDATA startManager(J9VMThread* currentThread, SH_Manager* manager);
 
+	static UDATA getItemCountHintDataType(SH_Manager* manager);
+
 	SH_ScopeManager* getScopeManager(J9VMThread* currentThread);
 
 	SH_ClasspathManager* getClasspathManager(J9VMThread* currentThread);
@@ -505,7 +505,9 @@ SH_ClasspathManagerImpl2::cpeTableAddHeader(J9VMThread* currentThread, const cha
 	while (retryCount < MONITOR_ENTER_RETRY_TIMES) {
 		if (_cache->enterLocalMutex(currentThread, _htMutex, "cpeTableMutex", "cpeTableAddHeader")==0) {
 			Trc_SHR_CMI_cpeTableAdd_HashtableAdd(currentThread);
+			startHashTableUpdate();
 			rc = (CpLinkedListHdr*)hashTableAdd(_hashTable, &header);
+			endHashTableUpdate();
 			if (rc == NULL) {
 				PORT_ACCESS_FROM_PORT(_portlib);
 				M_ERR_TRACE(J9NLS_SHRC_CMI_FAILED_CREATE_HASHTABLE_ENTRY);
@@ -559,7 +561,10 @@ SH_ClasspathManagerImpl2::cpeTableLookup(J9VMThread* currentThread, const char*
 
 	Trc_SHR_CMI_cpeTableLookup_Entry(currentThread, keySize, key, isToken);
 
-	if (lockHashTable(currentThread, "cpeTableLookup")) {
+	if (enterHashTableLockFree()) {
+		returnVal = cpeTableLookupHelper(currentThread, &dummy);
+		exitHashTableLockFree();
+	} else if (lockHashTable(currentThread, "cpeTableLookup")) {
 		returnVal = cpeTableLookupHelper(currentThread, &dummy);
 		unlockHashTable(currentThread, "cpeTableLookup");
 	} else {
@@ -156,9 +156,11 @@ SH_CompositeCacheImpl::SH_SharedCacheHeaderInit::init(BlockPtr data, U_32 len, I
 	ca->writerCount = 0;
 	ca->softMaxBytes = softMaxBytes;
 	ca->cacheFullFlags = 0;
-	ca->unused8 = 0;
-	ca->unused9 = 0;
-	ca->unused10 = 0;
+	ca->romClassCountHint = 0;
+	ca->classpathCountHint = 0;
+	ca->compiledMethodCountHint = 0;
+	ca->byteDataCountHint = 0;
+	ca->attachedDataCountHint = 0;
 	/* Note that the updateCountLockWord is only ever used single threaded, so no need to dereference this */
 	WSRP_SET(ca->updateCountPtr, &(ca->updateCount));
 	WSRP_SET(ca->corruptFlagPtr, &(ca->corruptFlag));
@@ -228,6 +230,10 @@ SH_CompositeCacheImpl::commonInit(J9JavaVM* vm)
 	_minimumAccessedShrCacheMetadata = 0;
 	_maximumAccessedShrCacheMetadata = 0;
 	_layer = 0;
+	memset(_itemCountHints, 0, sizeof(_itemCountHints));
+	_startupAccessBitmap = NULL;
+	_startupAccessNumPages = 0;
+	_recordingStartupAccess = false;
 }
 
 /*
@@ -420,6 +426,14 @@ SH_CompositeCacheImpl::cleanup(J9VMThread* currentThread)
 		omrthread_tls_free(_commonCCInfo->writeMutexEntryCount);
 		_commonCCInfo->writeMutexEntryCount = 0;
 	}
+
+	_recordingStartupAccess = false;
+	if (NULL != _startupAccessBitmap) {
+		PORT_ACCESS_FROM_PORT(_portlib);
+		j9mem_free_memory(_startupAccessBitmap);
+		_startupAccessBitmap = NULL;
+		_startupAccessNumPages = 0;
+	}
 	
 	Trc_SHR_CC_cleanup_Exit(currentThread);
 }
@@ -791,6 +805,13 @@ SH_CompositeCacheImpl::isLocked(void)
 	return  (ccToUse->_theca->locked != 0);
 }
 
+/**
+ * Set or clear the cache lock.
+ *
+ * lockGeneration is odd while the cache is locked and moves to a new even value when it is
+ * unlocked, so that readers not holding the read mutex can detect a lock that overlapped them.
+ * See startLockFreeRead() and endLockFreeRead().
+ */
 void
 SH_CompositeCacheImpl::setIsLocked(bool value)
 {
@@ -798,7 +819,64 @@ SH_CompositeCacheImpl::setIsLocked(bool value)
 
 	ccToUse = ((_ccHead == NULL) ? ((_parent == NULL) ? this : _parent) : _ccHead);
 	
-	ccToUse->_theca->locked = (U_32)value;
+	if (value) {
+		ccToUse->_theca->lockGeneration |= 1;
+		/* The odd generation must be visible before any data is changed under the lock */
+		VM_AtomicSupport::writeBarrier();
+		ccToUse->_theca->locked = (U_32)value;
+	} else {
+		ccToUse->_theca->locked = (U_32)value;
+		/* Changes made under the lock must be visible before the generation moves on */
+		VM_AtomicSupport::writeBarrier();
+		ccToUse->_theca->lockGeneration = (ccToUse->_theca->lockGeneration | 1) + 1;
+	}
+}
+
+/**
+ * Start a read of cache data without the read mutex.
+ *
+ * Data appended to the cache is never modified without locking the cache, so a reader that
+ * sees the same even lockGeneration before and after reading has read consistent data.
+ * Read-only caches keep using enterReadMutex(), which does not update the reader count.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [out] generation  The lock generation to pass to endLockFreeRead()
+ *
+ * @return true if the read may proceed without the read mutex, false if the cache is locked
+ */
+bool
+SH_CompositeCacheImpl::startLockFreeRead(J9VMThread* currentThread, UDATA* generation)
+{
+	SH_CompositeCacheImpl *ccToUse = ((_ccHead == NULL) ? ((_parent == NULL) ? this : _parent) : _ccHead);
+	UDATA current = 0;
+
+	if (!_started || (CC_READONLY_LOCK_VALUE == _commonCCInfo->writeMutexID)) {
+		return false;
+	}
+	current = ccToUse->_theca->lockGeneration;
+	VM_AtomicSupport::readBarrier();
+	if (J9_ARE_ANY_BITS_SET(current, 1) || isLocked()) {
+		return false;
+	}
+	*generation = current;
+	return true;
+}
+
+/**
+ * End a read started with startLockFreeRead().
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] generation  The lock generation returned by startLockFreeRead()
+ *
+ * @return true if the cache was not locked during the read, false if the data read must be discarded
+ */
+bool
+SH_CompositeCacheImpl::endLockFreeRead(J9VMThread* currentThread, UDATA generation)
+{
+	SH_CompositeCacheImpl *ccToUse = ((_ccHead == NULL) ? ((_parent == NULL) ? this : _parent) : _ccHead);
+
+	VM_AtomicSupport::readBarrier();
+	return (generation == ccToUse->_theca->lockGeneration);
 }
 
 void
@@ -1383,6 +1461,9 @@ SH_CompositeCacheImpl::startup(J9VMThread* currentThread, J9SharedClassPreinitCo
 					Trc_SHR_CC_Startup_CacheIsLocked(currentThread, _theca->crashCntr);
 					/* do not call doUnlockCache() as it tries to call unprotectHeaderReadWriteArea() which will assert on _started == false */
 					setIsLocked(false);
+				} else if (!_readOnlyOSCache && J9_ARE_ANY_BITS_SET(_theca->lockGeneration, 1)) {
+					/* The JVM crashed in setIsLocked() before setting the lock. Move to an even generation so that lock-free reads resume. */
+					setIsLocked(false);
 				}
 
 				if (READWRITEAREASIZE(_theca)) {
@@ -3733,6 +3814,7 @@ SH_CompositeCacheImpl::runExitCode(J9VMThread *currentThread)
 		IDATA lockrc = 0;
 		PORT_ACCESS_FROM_PORT(_portlib);
 		if ((lockrc = oscacheToUse->acquireWriteLock(_commonCCInfo->writeMutexID)) == 0) {
+			writeItemCountHints();
 			updateCacheCRC();
 			/* Deny updates so the CRC is not invalidated */
 			*_runtimeFlags |= J9SHR_RUNTIMEFLAG_DENY_CACHE_UPDATES;
@@ -3747,6 +3829,81 @@ SH_CompositeCacheImpl::runExitCode(J9VMThread *currentThread)
 	return;
 }
 
+/**
+ * Return the number of items of a given data type that were indexed by the last JVM
+ * that wrote to this cache. Used by the managers to size their hashtables at startup.
+ *
+ * @param[in] dataType  The data type
+ *
+ * @return The persisted item count, or 0 if none is recorded for this type
+ */
+UDATA
+SH_CompositeCacheImpl::getItemCountHint(UDATA dataType)
+{
+	if (!_started || (NULL == _theca)) {
+		return 0;
+	}
+	switch (dataType) {
+	case TYPE_ROMCLASS:
+		return _theca->romClassCountHint;
+	case TYPE_CLASSPATH:
+		return _theca->classpathCountHint;
+	case TYPE_COMPILED_METHOD:
+		return _theca->compiledMethodCountHint;
+	case TYPE_BYTE_DATA:
+		return _theca->byteDataCountHint;
+	case TYPE_ATTACHED_DATA:
+		return _theca->attachedDataCountHint;
+	default:
+		return 0;
+	}
+}
+
+/**
+ * Record the number of items of a given data type currently indexed by this JVM.
+ * The counts are written to the cache header by runExitCode().
+ *
+ * @param[in] dataType  The data type
+ * @param[in] count  The number of items indexed
+ */
+void
+SH_CompositeCacheImpl::setItemCountHint(UDATA dataType, UDATA count)
+{
+	if ((0 < dataType) && (dataType <= MAX_DATA_TYPES)) {
+		_itemCountHints[dataType] = count;
+	}
+}
+
+/**
+ * Write the item counts recorded by setItemCountHint() to the cache header.
+ * Counts of zero are not written, so that a JVM which did not start a manager
+ * does not discard the count from a previous JVM.
+ *
+ * @pre The caller must hold the cache write mutex and the header must be unprotected
+ */
+void
+SH_CompositeCacheImpl::writeItemCountHints(void)
+{
+	if (_readOnlyOSCache || (NULL == _theca)) {
+		return;
+	}
+	if (0 != _itemCountHints[TYPE_ROMCLASS]) {
+		_theca->romClassCountHint = _itemCountHints[TYPE_ROMCLASS];
+	}
+	if (0 != _itemCountHints[TYPE_CLASSPATH]) {
+		_theca->classpathCountHint = _itemCountHints[TYPE_CLASSPATH];
+	}
+	if (0 != _itemCountHints[TYPE_COMPILED_METHOD]) {
+		_theca->compiledMethodCountHint = _itemCountHints[TYPE_COMPILED_METHOD];
+	}
+	if (0 != _itemCountHints[TYPE_BYTE_DATA]) {
+		_theca->byteDataCountHint = _itemCountHints[TYPE_BYTE_DATA];
+	}
+	if (0 != _itemCountHints[TYPE_ATTACHED_DATA]) {
+		_theca->attachedDataCountHint = _itemCountHints[TYPE_ATTACHED_DATA];
+	}
+}
+
 /**
  * Return ID of this JVM
  */
@@ -5722,6 +5879,157 @@ SH_CompositeCacheImpl::dontNeedMetadata(J9VMThread *currentThread)
 		_oscache->dontNeedMetadata(currentThread, (const void *)min, length);
 	}
 }
+
+/**
+ * Return the page size used by the startup access profile of this cache
+ */
+UDATA
+SH_CompositeCacheImpl::getStartupAccessPageSize(void)
+{
+	if (0 != _osPageSize) {
+		return _osPageSize;
+	}
+	return J9SHR_STARTUP_ACCESS_DEFAULT_PAGE_SIZE;
+}
+
+/**
+ * Return the number of pages covered by the startup access profile of this cache.
+ * The profile covers the whole cache area, so that its size does not change as the ROMClass segment grows.
+ */
+UDATA
+SH_CompositeCacheImpl::getStartupAccessNumPages(void)
+{
+	UDATA pageSize = getStartupAccessPageSize();
+
+	if (!_started) {
+		return 0;
+	}
+	return (((UDATA)CAEND(_theca) - (UDATA)CASTART(_theca)) + pageSize - 1) / pageSize;
+}
+
+/**
+ * Start recording which pages of the ROMClass segment are accessed. The caller is expected to
+ * stop recording once the JVM leaves the startup phase.
+ *
+ * @param [in] currentThread  The current thread
+ *
+ * @return true if recording was started, false otherwise
+ */
+bool
+SH_CompositeCacheImpl::startStartupAccessRecording(J9VMThread* currentThread)
+{
+	UDATA numPages = getStartupAccessNumPages();
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if ((0 == numPages) || (NULL != _startupAccessBitmap)) {
+		return false;
+	}
+	_startupAccessBitmap = (U_32*)j9mem_allocate_memory(J9SHR_STARTUP_ACCESS_BITMAP_WORDS(numPages) * sizeof(U_32), J9MEM_CATEGORY_CLASSES);
+	if (NULL == _startupAccessBitmap) {
+		return false;
+	}
+	memset(_startupAccessBitmap, 0, J9SHR_STARTUP_ACCESS_BITMAP_WORDS(numPages) * sizeof(U_32));
+	_startupAccessNumPages = numPages;
+	_recordingStartupAccess = true;
+	return true;
+}
+
+/**
+ * Record an access to a range of the ROMClass segment of this cache.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] address  The start of the range accessed
+ * @param [in] length  The length of the range accessed
+ *
+ * @return true if the range is in this cache and the access was recorded, false otherwise
+ */
+bool
+SH_CompositeCacheImpl::recordStartupAccess(J9VMThread* currentThread, const void* address, UDATA length)
+{
+	U_32* bitmap = _startupAccessBitmap;
+
+	if (!_recordingStartupAccess || (NULL == bitmap) || !isAddressInROMClassSegment(address)) {
+		return false;
+	}
+
+	UDATA pageSize = getStartupAccessPageSize();
+	UDATA offset = (UDATA)address - (UDATA)CASTART(_theca);
+	UDATA page = offset / pageSize;
+	UDATA lastPage = (offset + ((0 == length) ? 0 : (length - 1))) / pageSize;
+
+	if (lastPage >= _startupAccessNumPages) {
+		lastPage = _startupAccessNumPages - 1;
+	}
+	for (; page <= lastPage; page++) {
+		U_32 mask = (U_32)1 << (page % 32);
+		/* Most accesses hit pages that are already recorded, so check before doing the atomic update */
+		if (0 == (bitmap[page / 32] & mask)) {
+			VM_AtomicSupport::bitOrU32(&bitmap[page / 32], mask);
+		}
+	}
+	return true;
+}
+
+/**
+ * Stop recording accesses to the ROMClass segment of this cache.
+ * The bitmap remains valid until the cache is cleaned up, as other threads may still be reading it.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [out] numPages  The number of pages covered by the returned bitmap
+ *
+ * @return A bitmap with one bit set for each page that was accessed, or NULL if nothing was recorded
+ */
+const U_32*
+SH_CompositeCacheImpl::stopStartupAccessRecording(J9VMThread* currentThread, UDATA* numPages)
+{
+	_recordingStartupAccess = false;
+	*numPages = _startupAccessNumPages;
+	return _startupAccessBitmap;
+}
+
+/**
+ * Advise the OS that the pages in the given startup access profile will be needed soon,
+ * so that they are read ahead in large runs rather than faulted in one at a time.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] bitmap  One bit for each page of the cache area, as produced by stopStartupAccessRecording()
+ * @param [in] numPages  The number of pages covered by bitmap
+ *
+ * @return The number of pages advised
+ */
+UDATA
+SH_CompositeCacheImpl::prefetchStartupPages(J9VMThread* currentThread, const U_32* bitmap, UDATA numPages)
+{
+	UDATA pageSize = getStartupAccessPageSize();
+	UDATA pagesAdvised = 0;
+	UDATA page = 0;
+
+	if (!_started || (NULL == _oscache) || (numPages != getStartupAccessNumPages())) {
+		/* The profile was recorded against a different cache layout */
+		return 0;
+	}
+	while (page < numPages) {
+		if (0 == (bitmap[page / 32] & ((U_32)1 << (page % 32)))) {
+			page += 1;
+			continue;
+		}
+		UDATA runStart = page;
+		while ((page < numPages) && (0 != (bitmap[page / 32] & ((U_32)1 << (page % 32))))) {
+			page += 1;
+		}
+		BlockPtr start = CASTART(_theca) + (runStart * pageSize);
+		BlockPtr end = CASTART(_theca) + (page * pageSize);
+		if (end > SEGUPDATEPTR(_theca)) {
+			end = SEGUPDATEPTR(_theca);
+		}
+		if (start < end) {
+			_oscache->willNeed(currentThread, start, (size_t)(end - start));
+			pagesAdvised += page - runStart;
+		}
+	}
+	return pagesAdvised;
+}
+
 /**
  * This function changes the permission of the page containing given address by marking the page as read-only or read-write.
  * The address may belong to either segment region, metadata region or class debug data region.
@@ -61,6 +61,10 @@
 /* Need a value that has negligible impact on performance */
 #define J9SHR_CRC_MAX_SAMPLES 100000
 
+/* Page size used for the startup access profile when the OS page size is not known */
+#define J9SHR_STARTUP_ACCESS_DEFAULT_PAGE_SIZE 4096
+#define J9SHR_STARTUP_ACCESS_BITMAP_WORDS(numPages) (((numPages) + 31) / 32)
+
 /**
  * Represents view of the shared cache at the level of blocks of memory.
  * 
@@ -219,6 +223,10 @@ public:
 	bool isAddressInCache(const void* address, bool includeHeaderReadWriteArea = true);
 
 	void runExitCode(J9VMThread *currentThread);
+
+	UDATA getItemCountHint(UDATA dataType);
+
+	void setItemCountHint(UDATA dataType, UDATA count);
 	
 	U_16 getJVMID(void);
 
@@ -379,6 +387,18 @@ public:
 
 	bool isAddressInReleasedMetaDataBounds(J9VMThread* currentThread, UDATA metadataAddress) const;
 
+	bool startStartupAccessRecording(J9VMThread* currentThread);
+
+	bool recordStartupAccess(J9VMThread* currentThread, const void* address, UDATA length);
+
+	const U_32* stopStartupAccessRecording(J9VMThread* currentThread, UDATA* numPages);
+
+	UDATA getStartupAccessPageSize(void);
+
+	UDATA getStartupAccessNumPages(void);
+
+	UDATA prefetchStartupPages(J9VMThread* currentThread, const U_32* bitmap, UDATA numPages);
+
 	const char* getCacheUniqueID(J9VMThread* currentThread) const;
 
 	const char* getCacheName(void) const;
@@ -395,6 +415,10 @@ public:
 	
 	bool hasReadMutex(J9VMThread* currentThread) const;
 
+	bool startLockFreeRead(J9VMThread* currentThread, UDATA* generation);
+
+	bool endLockFreeRead(J9VMThread* currentThread, UDATA generation);
+
 private:
 	J9SharedClassConfig* _sharedClassConfig;
 	SH_OSCache* _oscache;
@@ -464,6 +488,7 @@ private:
 	bool _doMetaProtect;
 	bool _doPartialPagesProtect;
 	bool _readOnlyOSCache;
+	UDATA _itemCountHints[MAX_DATA_TYPES + 1];
 #if defined (J9SHR_MSYNC_SUPPORT)
 	bool _doMetaSync;
 	bool _doHeaderSync;
@@ -486,6 +511,10 @@ private:
 	UDATA  _minimumAccessedShrCacheMetadata;
 
 	UDATA _maximumAccessedShrCacheMetadata;
+
+	U_32* _startupAccessBitmap;
+	UDATA _startupAccessNumPages;
+	bool _recordingStartupAccess;
 	
 	I_8 _layer;
 
@@ -528,6 +557,7 @@ private:
 	U_32 getCacheCRC(void);
 	U_32 getCacheAreaCRC(U_8* areaStart, U_32 areaSize);
 	void updateCacheCRC(void);
+	void writeItemCountHints(void);
 	bool checkCacheCRC(bool* cacheHasIntegrity, UDATA *crcValue);
 
 	IDATA setRegionPermissions(J9PortLibrary* portLibrary, void *address, UDATA length, UDATA flags);
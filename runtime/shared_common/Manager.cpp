@@ -41,6 +41,8 @@ SH_Manager::SH_Manager()
    _cache(0),
    _htMutex(0),
    _htMutexName("hllTableMutex"),
+   _htLockFreeReaders(0),
+   _htUpdating(0),
    _portlib(0),
    _htEntries(0),
    _runtimeFlagsPtr(0),
@@ -180,12 +182,13 @@ _exit :
  * @param[in] runtimeFlags_ A pointer to the runtimeFlags in use
  * @param[in] verboseFlags_ The verbose flags in use
  * @param[in] cacheSizeBytes The cache size, in bytes
+ * @param[in] itemCountHint The number of items indexed by the last JVM to use the cache, or 0 if unknown
  *
  * @return 0 for success, -1 for failure, otherwise if it is the wrong state, it returns the current state.
  */
 /* THREADING: Can be called multi-threaded. Only one thread should win the compareAndSwap and run startup. */
 IDATA
-SH_Manager::startup(J9VMThread* currentThread, U_64* runtimeFlags_, UDATA verboseFlags_, UDATA cacheSizeBytes)
+SH_Manager::startup(J9VMThread* currentThread, U_64* runtimeFlags_, UDATA verboseFlags_, UDATA cacheSizeBytes, UDATA itemCountHint)
 {
 	UDATA actualState;
 
@@ -205,6 +208,11 @@ SH_Manager::startup(J9VMThread* currentThread, U_64* runtimeFlags_, UDATA verbos
 	_runtimeFlagsPtr = runtimeFlags_;
 	_verboseFlags = verboseFlags_;
 	_htEntries = getHashTableEntriesFromCacheSize(cacheSizeBytes);
+	if (0 != itemCountHint) {
+		/* The previous JVM recorded how many items it indexed. Size the table from that,
+		 * with some headroom for items added since, rather than from the cache size. */
+		_htEntries = (U_32)(itemCountHint + (itemCountHint / 4) + 20);
+	}
 
 	if (omrthread_monitor_init(&_htMutex, 0)) {
 		PORT_ACCESS_FROM_PORT(_portlib);
@@ -266,7 +274,9 @@ SH_Manager::cleanup(J9VMThread* currentThread)
 
 	if ((_state == MANAGER_STATE_STARTED) || (_state == MANAGER_STATE_STARTING)) {
 		if (!_htMutex || (_cache->enterLocalMutex(currentThread, _htMutex, "_htMutex", "cleanup")==0)) {
+			startHashTableUpdate();
 			tearDownHashTable(currentThread);
+			endHashTableUpdate();
 			localPostCleanup(currentThread);
 			_cache->exitLocalMutex(currentThread, _htMutex, "_htMutex", "cleanup");
 		}
@@ -300,10 +310,12 @@ SH_Manager::reset(J9VMThread* currentThread)
 
 	if (_state == MANAGER_STATE_STARTED) {
 		if (_cache->enterLocalMutex(currentThread, _htMutex, "_htMutex", "reset")==0) {
+			startHashTableUpdate();
 			tearDownHashTable(currentThread);
 			if (initializeHashTable(currentThread) == -1) {
 				returnVal = -1;
 			}
+			endHashTableUpdate();
 			_cache->exitLocalMutex(currentThread, _htMutex, "_htMutex", "reset");
 		}
 	}
@@ -374,7 +386,10 @@ SH_Manager::hllTableAdd(J9VMThread* currentThread, const J9Pool* linkPool, const
 
 			/* This call will not actually add the new item if there is already an entry of the same key in the hashtable. Instead, the value returned
 				by hashTableAdd is passed back as the addToList parameter. The value returned by this function should then be linked to addToList */
-			if ((rc = (HashLinkedListImpl**)hashTableAdd(_hashTable, &newItem))==NULL) {
+			startHashTableUpdate();
+			rc = (HashLinkedListImpl**)hashTableAdd(_hashTable, &newItem);
+			endHashTableUpdate();
+			if (rc == NULL) {
 				Trc_SHR_M_hllTableAdd_Exception1(currentThread);
 				M_ERR_TRACE(J9NLS_SHRC_M_FAILED_CREATE_HASHTABLE_ENTRY);
 				newItem = NULL;		/* Return null, but must exit mutex first */
@@ -408,7 +423,10 @@ SH_Manager::hllTableLookup(J9VMThread* currentThread, const char* name, U_16 nam
 
 	Trc_SHR_M_hllTableLookup_Entry(currentThread, nameLen, name);
 
-	if (lockHashTable(currentThread, "hllTableLookup")) {
+	if (enterHashTableLockFree()) {
+		result = hllTableLookupHelper(currentThread, (U_8*)name, nameLen, 0, NULL);
+		exitHashTableLockFree();
+	} else if (lockHashTable(currentThread, "hllTableLookup")) {
 		result = hllTableLookupHelper(currentThread, (U_8*)name, nameLen, 0, NULL);
 		unlockHashTable(currentThread, "hllTableLookup");
 	} else {
@@ -493,6 +511,68 @@ SH_Manager::unlockHashTable(J9VMThread* currentThread, const char* funcName)
 	_cache->exitLocalMutex(currentThread, _htMutex, _htMutexName, funcName);
 }
 
+/**
+ * Start a lookup of _hashTable without _htMutex, so that concurrent lookups do not serialize on it.
+ * Lookups only read the hashtable, so they can run concurrently with each other but not with an update,
+ * which may grow the hashtable and free its previous storage.
+ *
+ * @return true if the lookup may proceed, and must be followed by exitHashTableLockFree(),
+ * or false if an update is in progress and the lookup must hold _htMutex
+ *
+ * THREADING: Can be called multi-threaded
+ */
+bool
+SH_Manager::enterHashTableLockFree(void)
+{
+	VM_AtomicSupport::add(&_htLockFreeReaders, 1);
+	/* Order the reader count update before the check of _htUpdating, startHashTableUpdate() does the reverse */
+	VM_AtomicSupport::readWriteBarrier();
+	if (0 != _htUpdating) {
+		VM_AtomicSupport::subtract(&_htLockFreeReaders, 1);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * End a lookup started by a successful call to enterHashTableLockFree().
+ *
+ * THREADING: Can be called multi-threaded
+ */
+void
+SH_Manager::exitHashTableLockFree(void)
+{
+	VM_AtomicSupport::subtract(&_htLockFreeReaders, 1);
+}
+
+/**
+ * Wait for the lookups running without _htMutex to finish before updating _hashTable.
+ * New lookups hold _htMutex until endHashTableUpdate() is called.
+ *
+ * THREADING: Must be called with _htMutex held
+ */
+void
+SH_Manager::startHashTableUpdate(void)
+{
+	_htUpdating = 1;
+	VM_AtomicSupport::readWriteBarrier();
+	while (0 != _htLockFreeReaders) {
+		omrthread_yield();
+	}
+}
+
+/**
+ * Allow lookups of _hashTable without _htMutex again.
+ *
+ * THREADING: Must be called with _htMutex held
+ */
+void
+SH_Manager::endHashTableUpdate(void)
+{
+	VM_AtomicSupport::writeBarrier();
+	_htUpdating = 0;
+}
+
 UDATA
 SH_Manager::generateHash(J9InternalVMFunctions* internalFunctionTable, U_8* key, U_16 keySize)
 {
@@ -607,3 +687,16 @@ SH_Manager::isDataTypeRepresended(UDATA type)
 	return false;
 }
 
+/**
+ * Return the number of entries in the local hashtable
+ *
+ * @return The number of entries, or 0 if the manager has not been started
+ */
+UDATA
+SH_Manager::getHashTableEntryCount(void)
+{
+	if ((MANAGER_STATE_STARTED != _state) || (NULL == _hashTable)) {
+		return 0;
+	}
+	return hashTableGetCount(_hashTable);
+}
@@ -139,7 +139,7 @@ public:
 
 	void shutDown(J9VMThread* currentThread);
 
-	IDATA startup(J9VMThread* currentThread, U_64* runtimeFlags, UDATA verboseFlags, UDATA cacheSize);
+	IDATA startup(J9VMThread* currentThread, U_64* runtimeFlags, UDATA verboseFlags, UDATA cacheSize, UDATA itemCountHint);
 
 	U_8 getState();
 
@@ -149,11 +149,15 @@ public:
 
 	bool isDataTypeRepresended(UDATA type);
 
+	UDATA getHashTableEntryCount(void);
+
 protected:
 	J9HashTable* _hashTable;
 	SH_SharedCache* _cache;
 	omrthread_monitor_t _htMutex;
 	const char* _htMutexName;
+	volatile UDATA _htLockFreeReaders; /**< number of threads looking up _hashTable without _htMutex */
+	volatile UDATA _htUpdating; /**< non-zero while the thread holding _htMutex updates _hashTable */
 	J9PortLibrary* _portlib;
 	U_32 _htEntries;
 	U_64* _runtimeFlagsPtr;
@@ -207,6 +211,14 @@ protected:
 	bool lockHashTable(J9VMThread* currentThread, const char* funcName);
 	void unlockHashTable(J9VMThread* currentThread, const char* funcName);
 
+	/* Look up _hashTable without _htMutex. If this fails, an update is in progress and the caller must use lockHashTable() */
+	bool enterHashTableLockFree(void);
+	void exitHashTableLockFree(void);
+
+	/* Bracket any change to _hashTable, with _htMutex held, so that it does not run concurrently with lock-free lookups */
+	void startHashTableUpdate(void);
+	void endHashTableUpdate(void);
+
 	static UDATA hllHashFn(void* item, void *userData);
 	static UDATA hllHashEqualFn(void* left, void* right, void *userData);
 
@@ -66,6 +66,12 @@ SH_Managers::addManager(SH_Manager* manager)
 
 	_initializedManagers[index] = manager;
 	retval = _initializedManagers[index];
+
+	for (UDATA dataType = TYPE_UNINITIALIZED + 1; dataType <= MAX_DATA_TYPES; dataType++) {
+		if (manager->isDataTypeRepresended(dataType)) {
+			_managersByDataType[dataType] = manager;
+		}
+	}
 	return retval;
 }
 
@@ -106,15 +112,10 @@ SH_Manager*
 SH_Managers::getManagerForDataType(UDATA dataType)
 {
 	SH_Manager* retval = NULL;
-	UDATA i;
-	/* TODO: Optimize */
-	for (i=0; i<NUM_MANAGERS; i++) {
-		if (_initializedManagers[i]->isDataTypeRepresended(dataType) == true) {
-			retval = _initializedManagers[i];
-			goto done;
-		}
+
+	if ((dataType > TYPE_UNINITIALIZED) && (dataType <= MAX_DATA_TYPES)) {
+		retval = _managersByDataType[dataType];
 	}
-	done:
 	return retval;
 }
 
@@ -127,6 +128,9 @@ SH_Managers::initialize()
 	for (i = 0; i<NUM_MANAGERS; i++) {
 		_initializedManagers[i] = 0;
 	}
+	for (i = 0; i <= MAX_DATA_TYPES; i++) {
+		_managersByDataType[i] = NULL;
+	}
 	return;
 }
 
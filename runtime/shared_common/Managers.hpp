@@ -61,6 +61,7 @@ protected:
 private:
 	SH_Manager* _initializedManagers[NUM_MANAGERS];
 	UDATA _initializedManagersCntr;
+	SH_Manager* _managersByDataType[MAX_DATA_TYPES + 1]; /* Indexed by data type, so that dispatching each cache item does not search the managers */
 
 	void initialize();
 };
@@ -455,6 +455,12 @@ SH_OSCache::dontNeedMetadata(J9VMThread* currentThread, const void* startAddress
 	return;
 }
 
+/* override if the cache is backed by a file that may not be in memory */
+void
+SH_OSCache::willNeed(J9VMThread* currentThread, const void* startAddress, size_t length) {
+	return;
+}
+
 /* Function that initializes class variables common to OSCache subclasses */
 void
 SH_OSCache::commonInit(J9PortLibrary* portLibrary, UDATA generation, I_8 layer)
@@ -26,6 +26,10 @@
  */
 
 #include <string.h>
+#if defined(LINUX)
+#include <stdio.h>
+#include <sys/mman.h>
+#endif /* defined(LINUX) */
 #include "j2sever.h"
 #include "j9cfg.h"
 #include "j9port.h"
@@ -103,6 +107,7 @@ SH_OSCachemmap::initialize(J9PortLibrary* portLibrary, char* memForConstructor,
 	_corruptionCode = NO_CORRUPTION;
 	_corruptValue = NO_CORRUPTION;
 	_cacheFileAccess = J9SH_CACHE_FILE_ACCESS_ALLOWED;
+	_mmapFlags = 0;
 	Trc_SHR_OSC_Mmap_initialize_Exit();
 }
 
@@ -195,6 +200,11 @@ SH_OSCachemmap::startup(J9JavaVM* vm, const char* ctrlDirName, UDATA cacheDirPer
 	}
 	Trc_SHR_OSC_Mmap_startup_commonStartupSuccess();
 
+	/* Utilities that only read the cache statistics do not need the mapping tuned */
+	if ((NULL != vm->sharedCacheAPI) && (J9SH_OSCACHE_OPEXIST_STATS != createFlag)) {
+		_mmapFlags = vm->sharedCacheAPI->mmapFlags;
+	}
+
 	/* Detect remote filesystem */
 	if (openMode & J9OSCACHE_OPEN_MODE_CHECK_NETWORK_CACHE) {
 		if (0 == j9file_stat(_cacheDirName, 0, &statBuf)) {
@@ -463,6 +473,140 @@ SH_OSCachemmap::dontNeedMetadata(J9VMThread* currentThread, const void* startAdd
 #endif
 }
 
+/**
+ * Advise the OS that a section of the shared classes cache will be accessed soon,
+ * so that it is read from the cache file ahead of the page faults.
+ */
+void
+SH_OSCachemmap::willNeed(J9VMThread* currentThread, const void* startAddress, size_t length) {
+#if defined(LINUX)
+	PORT_ACCESS_FROM_VMC(currentThread);
+	UDATA pageSize = j9vmem_supported_page_sizes()[0];
+	UDATA alignedStart = ((UDATA)startAddress) & ~(pageSize - 1);
+
+	madvise((void*)alignedStart, length + ((UDATA)startAddress - alignedStart), MADV_WILLNEED);
+#endif /* defined(LINUX) */
+}
+
+#if defined(LINUX)
+/**
+ * Read from /proc/self/smaps how much of a mapping is backed by huge pages.
+ * Only the pages populated so far are counted.
+ *
+ * @param [in] start  The start address of the mapping
+ *
+ * @return the number of bytes mapped with huge pages, or -1 if smaps could not be read
+ */
+static I_64
+getHugePageMappedBytes(void* start)
+{
+	FILE* smaps = fopen("/proc/self/smaps", "r");
+	char line[256];
+	bool inMapping = false;
+	I_64 hugePageKB = -1;
+
+	if (NULL == smaps) {
+		return -1;
+	}
+	while (NULL != fgets(line, sizeof(line), smaps)) {
+		unsigned long mappingStart = 0;
+		unsigned long mappingEnd = 0;
+		unsigned long kb = 0;
+
+		if (2 == sscanf(line, "%lx-%lx", &mappingStart, &mappingEnd)) {
+			/* A new mapping starts, the cache mapping ends here if it was being read */
+			if (inMapping) {
+				break;
+			}
+			inMapping = (mappingStart == (unsigned long)(UDATA)start);
+			if (inMapping) {
+				hugePageKB = 0;
+			}
+		} else if (inMapping
+			/* Shared memory (tmpfs) and other file-backed transparent huge pages */
+			&& ((1 == sscanf(line, "ShmemPmdMapped: %lu kB", &kb))
+				|| (1 == sscanf(line, "FilePmdMapped: %lu kB", &kb))
+				|| (1 == sscanf(line, "AnonHugePages: %lu kB", &kb)))
+		) {
+			hugePageKB += (I_64)kb;
+		}
+	}
+	fclose(smaps);
+
+	return (-1 == hugePageKB) ? -1 : (hugePageKB * 1024);
+}
+#endif /* defined(LINUX) */
+
+/**
+ * Apply -Xshareclasses:mmapHugePages and -Xshareclasses:mmapPrefault to the mapping of the cache file.
+ *
+ * File-backed mappings can only use transparent huge pages where the file system supports them
+ * (e.g. tmpfs with huge pages enabled). madvise(MADV_HUGEPAGE) succeeds on other file systems too,
+ * so once the mapping has been prefaulted, /proc/self/smaps is checked for the huge pages actually used.
+ * Without mmapPrefault no page is populated yet, and only a failing madvise() can be reported.
+ * Prefaulting populates the page tables for the whole cache up front rather than taking a minor
+ * fault on the first access to each page. Pages are populated for reading, so they are not dirtied.
+ */
+void
+SH_OSCachemmap::adviseCacheMapping(void)
+{
+#if defined(LINUX)
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	void* start = _headerStart;
+	size_t length = (size_t)_actualFileLength;
+
+	bool hugePagesAdvised = false;
+
+	if (J9_ARE_ALL_BITS_SET(_mmapFlags, J9SHR_MMAP_FLAG_HUGE_PAGES)) {
+		IDATA rc = -1;
+#if defined(MADV_HUGEPAGE)
+		rc = madvise(start, length, MADV_HUGEPAGE);
+#endif /* defined(MADV_HUGEPAGE) */
+		Trc_SHR_OSC_Mmap_adviseCacheMapping_hugePages(start, length, rc);
+		if (0 != rc) {
+			OSC_TRACE1(J9NLS_SHRC_OSCACHE_MMAP_HUGE_PAGES_UNAVAILABLE, _cacheName);
+		} else {
+			hugePagesAdvised = true;
+		}
+	}
+
+	if (J9_ARE_ALL_BITS_SET(_mmapFlags, J9SHR_MMAP_FLAG_PREFAULT)) {
+		I_64 startTime = j9time_current_time_millis();
+		IDATA rc = -1;
+#if defined(MADV_POPULATE_READ)
+		rc = madvise(start, length, MADV_POPULATE_READ);
+#endif /* defined(MADV_POPULATE_READ) */
+		if (0 != rc) {
+			/* Kernels before 5.14 do not support MADV_POPULATE_READ, so touch each page instead */
+			UDATA pageSize = j9vmem_supported_page_sizes()[0];
+			volatile U_8* cursor = (volatile U_8*)start;
+			volatile U_8* end = cursor + length;
+			U_8 touched = 0;
+
+			while (cursor < end) {
+				touched ^= *cursor;
+				cursor += pageSize;
+			}
+			Trc_SHR_OSC_Mmap_adviseCacheMapping_touchedPages(start, length, touched);
+		}
+		I_64 elapsed = j9time_current_time_millis() - startTime;
+		Trc_SHR_OSC_Mmap_adviseCacheMapping_prefault(start, length, elapsed);
+		OSC_TRACE3(J9NLS_SHRC_OSCACHE_MMAP_PREFAULTED, (U_64)length, _cacheName, elapsed);
+
+		if (hugePagesAdvised) {
+			I_64 hugePageBytes = getHugePageMappedBytes(start);
+
+			Trc_SHR_OSC_Mmap_adviseCacheMapping_hugePagesMapped(start, length, hugePageBytes);
+			if (0 == hugePageBytes) {
+				OSC_TRACE1(J9NLS_SHRC_OSCACHE_MMAP_HUGE_PAGES_UNAVAILABLE, _cacheName);
+			} else if (0 < hugePageBytes) {
+				OSC_TRACE2(J9NLS_SHRC_OSCACHE_MMAP_HUGE_PAGES_MAPPED, (U_64)hugePageBytes, _cacheName);
+			}
+		}
+	}
+#endif /* defined(LINUX) */
+}
+
 /**
  * Destroy a persistent shared classes cache
  *
@@ -1000,6 +1144,7 @@ SH_OSCachemmap::internalAttach(bool isNewCache, UDATA generation)
 	}
 	_headerStart = _mapFileHandle->pointer;
 	Trc_SHR_OSC_Mmap_internalAttach_goodmapfile(_headerStart);
+	adviseCacheMapping();
 
 	if (!isNewCache) {
 		J9SRP* dataStartField;
@@ -94,6 +94,7 @@ public:
 
 	SH_CacheAccess isCacheAccessible(void) const;
 	virtual void dontNeedMetadata(J9VMThread* currentThread, const void* startAddress, size_t length);
+	virtual void willNeed(J9VMThread* currentThread, const void* startAddress, size_t length);
 
 protected:
 	virtual void * getAttachedMemory();
@@ -108,11 +109,14 @@ private:
 	
 	SH_CacheFileAccess _cacheFileAccess;
 
+	U_32 _mmapFlags;
+
 	IDATA acquireAttachReadLock(UDATA generation, LastErrorInfo *lastErrorInfo);
 	IDATA releaseAttachReadLock(UDATA generation);
 
 	IDATA internalAttach(bool isNewCache, UDATA generation);
 	void internalDetach(UDATA generation);
+	void adviseCacheMapping(void);
 	
 	I_32 updateLastAttachedTime(OSCachemmap_header_version_current *cacheHeader);
 	I_32 updateLastDetachedTime();
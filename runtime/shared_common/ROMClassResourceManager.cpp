@@ -114,7 +114,9 @@ SH_ROMClassResourceManager::rrmTableAdd(J9VMThread* currentThread, const ShcItem
 	HashTableEntry* rc = NULL;
 
 	if (lockHashTable(currentThread, _rrmAddFnName)) {
+		startHashTableUpdate();
 		rc = rrmTableAddHelper(currentThread, &newItem, cachelet);
+		endHashTableUpdate();
 	
 		/* if the item was primed, fill in its value */
 		if (rc->item() == NULL) {
@@ -139,7 +141,11 @@ SH_ROMClassResourceManager::rrmTableLookup(J9VMThread* currentThread, UDATA key)
 
 	Trc_SHR_RRM_rrmTableLookup_Entry(currentThread, key);
 
-	if (lockHashTable(currentThread, _rrmLookupFnName)) {
+	if (enterHashTableLockFree()) {
+		returnVal = (HashTableEntry*)hashTableFind(_hashTable, (void*)&searchKey);
+		Trc_SHR_RRM_rrmTableLookup_HashtableFind(currentThread, returnVal);
+		exitHashTableLockFree();
+	} else if (lockHashTable(currentThread, _rrmLookupFnName)) {
 		returnVal = (HashTableEntry*)hashTableFind(_hashTable, (void*)&searchKey);
 		Trc_SHR_RRM_rrmTableLookup_HashtableFind(currentThread, returnVal);
 		unlockHashTable(currentThread, _rrmLookupFnName);
@@ -170,7 +176,9 @@ SH_ROMClassResourceManager::rrmTableRemove(J9VMThread* currentThread, UDATA key)
 
 	while (retryCount < MONITOR_ENTER_RETRY_TIMES) {
 		if (_cache->enterLocalMutex(currentThread, _htMutex, _htMutexName, _rrmRemoveFnName)==0) {
+			startHashTableUpdate();
 			returnVal = hashTableRemove(_hashTable, (void*)&searchKey);
+			endHashTableUpdate();
 			Trc_SHR_RRM_rrmTableRemove_HashtableRemove(currentThread, returnVal);
 			_cache->exitLocalMutex(currentThread, _htMutex, _htMutexName, _rrmRemoveFnName);
 			break;
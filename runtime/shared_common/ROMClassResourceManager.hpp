@@ -61,7 +61,10 @@ public:
 		HashTableEntry searchKey(resourceKey, 0, NULL);
 		HashTableEntry* returnVal = NULL;
 
-		if (omrthread_monitor_enter(_htMutex)==0) {
+		if (enterHashTableLockFree()) {
+			returnVal = (HashTableEntry*)hashTableFind(_hashTable, (void*)&searchKey);
+			exitHashTableLockFree();
+		} else if (omrthread_monitor_enter(_htMutex)==0) {
 			returnVal = (HashTableEntry*)hashTableFind(_hashTable, (void*)&searchKey);
 			omrthread_monitor_exit(_htMutex);
 		}
@@ -116,7 +116,10 @@ SH_ScopeManagerImpl::scTableAdd(J9VMThread* currentThread, const ShcItem* item,
 	Trc_SHR_SMI_scTableAdd_Entry(currentThread, J9UTF8_LENGTH(key), J9UTF8_DATA(key), item);
 	
 	if (lockHashTable(currentThread, "scTableAdd")) {
-		if ((returnVal = (HashEntry*)hashTableAdd(_hashTable, &entry))==NULL) {
+		startHashTableUpdate();
+		returnVal = (HashEntry*)hashTableAdd(_hashTable, &entry);
+		endHashTableUpdate();
+		if (returnVal == NULL) {
 			Trc_SHR_SMI_scTableAdd_Exception1(currentThread);
 			M_ERR_TRACE(J9NLS_SHRC_SMI_FAILED_CREATE_HASHTABLE_ENTRY);
 		}
@@ -146,7 +149,11 @@ SH_ScopeManagerImpl::scTableLookup(J9VMThread* currentThread, const J9UTF8* key)
 	
 	Trc_SHR_SMI_scTableLookup_Entry(currentThread, J9UTF8_LENGTH(key), J9UTF8_DATA(key));
 	
-	if (lockHashTable(currentThread, "scTableLookup")) {
+	if (enterHashTableLockFree()) {
+		found = (const HashEntry*)hashTableFind(_hashTable, (void*)&searchEntry);
+		Trc_SHR_SMI_scTableLookup_HashtableFind(currentThread, found);
+		exitHashTableLockFree();
+	} else if (lockHashTable(currentThread, "scTableLookup")) {
 		found = (const HashEntry*)hashTableFind(_hashTable, (void*)&searchEntry);
 		Trc_SHR_SMI_scTableLookup_HashtableFind(currentThread, found);
 		unlockHashTable(currentThread, "scTableLookup");
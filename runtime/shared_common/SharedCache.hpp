@@ -114,6 +114,8 @@ public:
 	
 	virtual U_8* getDataFromByteDataWrapper(const ByteDataWrapper* bdw) = 0;
 
+	virtual U_8* getUncompressedByteData(J9VMThread* currentThread, const ByteDataWrapper* bdw, UDATA* dataLen) = 0;
+
 protected:
 	/* - Virtual destructor has been added to avoid compile warnings. 
 	 * - Delete operator added to avoid linkage with C++ runtime libs 
@@ -73,6 +73,21 @@ public:
 	 * 					(Contains the current timestamp)
 	 */
 	virtual I_64 checkROMClassTimeStamp(J9VMThread* currentThread, const char* className, UDATA classNameLen, ClasspathEntryItem* cpei, ROMClassWrapper* rcWrapper) = 0;
+
+	/*
+	 * Reports how many classpath entry timestamps were read from the filesystem
+	 * and how many checks were answered from previously validated timestamps.
+	 *
+	 * Parameters:
+	 *   checked		Set to the number of filesystem timestamp reads
+	 *   avoided		Set to the number of filesystem timestamp reads avoided
+	 */
+	virtual void getTimestampCheckCounts(UDATA* checked, UDATA* avoided) = 0;
+
+	/*
+	 * Frees any resources held by the timestamp manager.
+	 */
+	virtual void cleanup(J9VMThread* currentThread) = 0;
 protected:
 	/* - Virtual destructor has been added to avoid compile warnings. 
 	 * - Delete operator added to avoid linkage with C++ runtime libs 
@@ -24,6 +24,12 @@
 #include "CacheMap.hpp"
 #include "ut_j9shr.h"
 #include <string.h>
+#if defined(LINUX)
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif /* defined(LINUX) */
+
+#define TSM_WATCH_EVENT_BUFFER_SIZE 4096
 
 SH_TimestampManagerImpl*
 SH_TimestampManagerImpl::newInstance(J9JavaVM* vm, SH_TimestampManagerImpl* memForConstructor, J9SharedClassConfig* sharedClassConfig)
@@ -32,6 +38,32 @@ SH_TimestampManagerImpl::newInstance(J9JavaVM* vm, SH_TimestampManagerImpl* memF
 
 	new(newTSM) SH_TimestampManagerImpl();
 	newTSM->_sharedClassConfig = sharedClassConfig;
+	newTSM->_validatedTimestamps = NULL;
+	newTSM->_watchedEntries = NULL;
+	newTSM->_validatedTimestampsMutex = NULL;
+	newTSM->_checkIntervalMillis = 0;
+	newTSM->_lastWatchReadMillis = 0;
+	newTSM->_watchFD = -1;
+	newTSM->_timestampsChecked = 0;
+	newTSM->_timestampsAvoided = 0;
+
+	if (NULL != vm->sharedCacheAPI) {
+		newTSM->_checkIntervalMillis = (I_64)vm->sharedCacheAPI->timestampCheckIntervalMillis;
+	}
+	if (0 < newTSM->_checkIntervalMillis) {
+		/* If the table cannot be created, every check goes to the filesystem as before */
+		if (0 == omrthread_monitor_init(&newTSM->_validatedTimestampsMutex, 0)) {
+			newTSM->_validatedTimestamps = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), J9_GET_CALLSITE(), 64, sizeof(ValidatedTimestamp), sizeof(char *), 0, J9MEM_CATEGORY_CLASSES, SH_TimestampManagerImpl::vtHashFn, SH_TimestampManagerImpl::vtHashEqualFn, NULL, (void*)vm->internalVMFunctions);
+		}
+#if defined(LINUX)
+		if (NULL != newTSM->_validatedTimestamps) {
+			newTSM->_watchedEntries = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), J9_GET_CALLSITE(), 64, sizeof(WatchedEntries), sizeof(IDATA), 0, J9MEM_CATEGORY_CLASSES, SH_TimestampManagerImpl::weHashFn, SH_TimestampManagerImpl::weHashEqualFn, NULL, NULL);
+		}
+		if (NULL != newTSM->_watchedEntries) {
+			newTSM->_watchFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		}
+#endif /* defined(LINUX) */
+	}
 
 	return newTSM;
 }
@@ -67,7 +99,13 @@ SH_TimestampManagerImpl::localCheckTimeStamp(J9VMThread* currentThread, Classpat
 	bool doFreeBuffer = false;
 
 	PORT_ACCESS_FROM_PORT(currentThread->javaVM->portLibrary);
-	
+
+	/* Only timestamps of classpath entries themselves are remembered, not those of individual classfiles */
+	if ((NULL == className) && findValidatedTimestamp(currentThread, cpei, &current)) {
+		Trc_SHR_TMI_LocalCheckTimestamp_Validated(currentThread, current);
+		goto compare;
+	}
+
 	if (cpei->protocol==PROTO_DIR) {
 		/* If stack buffer not big enough, doFreeBuffer is set to true */
 		SH_CacheMap::createPathString(currentThread, _sharedClassConfig, &pathBufPtr, SHARE_PATHBUF_SIZE, cpei, className, classNameLen, &doFreeBuffer);
@@ -85,10 +123,28 @@ SH_TimestampManagerImpl::localCheckTimeStamp(J9VMThread* currentThread, Classpat
 	if (!pathBufPtr) {
 		return TIMESTAMP_DOES_NOT_EXIST;
 	}
-	current = j9file_lastmod(pathBufPtr);
+	if ((NULL == className) && (NULL != _validatedTimestamps)) {
+		/* Watch before reading the timestamp so that no change made after the read is missed */
+		IDATA watchDescriptor = -1;
+#if defined(LINUX)
+		if (-1 != _watchFD) {
+			U_32 mask = IN_ATTRIB | IN_MODIFY | IN_CLOSE_WRITE | IN_MOVE_SELF | IN_DELETE_SELF;
+			if (PROTO_DIR == cpei->protocol) {
+				/* Classes added, removed or renamed in a directory entry change its timestamp */
+				mask |= IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+			}
+			watchDescriptor = inotify_add_watch((int)_watchFD, pathBufPtr, mask);
+		}
+#endif /* defined(LINUX) */
+		current = j9file_lastmod(pathBufPtr);
+		storeValidatedTimestamp(currentThread, cpei, current, watchDescriptor);
+	} else {
+		current = j9file_lastmod(pathBufPtr);
+	}
 	if (doFreeBuffer) {
 		j9mem_free_memory(pathBufPtr);
 	}
+compare:
 	if (current == -1) {
 		if (test == -1) {
 			return TIMESTAMP_DOES_NOT_EXIST;
@@ -104,4 +160,353 @@ SH_TimestampManagerImpl::localCheckTimeStamp(J9VMThread* currentThread, Classpat
 	}
 }
 
+void
+SH_TimestampManagerImpl::getTimestampCheckCounts(UDATA* checked, UDATA* avoided)
+{
+	*checked = _timestampsChecked;
+	*avoided = _timestampsAvoided;
+}
+
+void
+SH_TimestampManagerImpl::cleanup(J9VMThread* currentThread)
+{
+	if (NULL != _validatedTimestamps) {
+		hashTableForEachDo(_validatedTimestamps, SH_TimestampManagerImpl::vtFreeFn, (void*)currentThread->javaVM->portLibrary);
+		hashTableFree(_validatedTimestamps);
+		_validatedTimestamps = NULL;
+	}
+	if (NULL != _watchedEntries) {
+		hashTableFree(_watchedEntries);
+		_watchedEntries = NULL;
+	}
+	if (NULL != _validatedTimestampsMutex) {
+		omrthread_monitor_destroy(_validatedTimestampsMutex);
+		_validatedTimestampsMutex = NULL;
+	}
+#if defined(LINUX)
+	if (-1 != _watchFD) {
+		/* Closing the inotify instance removes all of its watches */
+		close((int)_watchFD);
+		_watchFD = -1;
+	}
+#endif /* defined(LINUX) */
+}
+
+/**
+ * Look up a timestamp of a classpath entry that is still considered valid.
+ * A timestamp is valid for checkInterval milliseconds after it was read. After that, a
+ * timestamp of an entry watched with inotify remains valid until a change is reported.
+ *
+ * THREADING: Can be called multi-threaded
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] cpei  The classpath entry to look up
+ * @param [out] lastModified  Set to the timestamp if one is found
+ *
+ * @return true if a valid timestamp was found, false if the filesystem must be checked
+ */
+bool
+SH_TimestampManagerImpl::findValidatedTimestamp(J9VMThread* currentThread, ClasspathEntryItem* cpei, I_64* lastModified)
+{
+	ValidatedTimestamp query;
+	ValidatedTimestamp* entry = NULL;
+	U_16 pathLen = 0;
+	I_64 now = 0;
+	bool found = false;
+	PORT_ACCESS_FROM_PORT(currentThread->javaVM->portLibrary);
+
+	if (NULL == _validatedTimestamps) {
+		return false;
+	}
+	query.path = (char*)cpei->getLocation(&pathLen);
+	query.pathLen = pathLen;
+	now = j9time_current_time_millis();
+
+	omrthread_monitor_enter(_validatedTimestampsMutex);
+	entry = (ValidatedTimestamp*)hashTableFind(_validatedTimestamps, &query);
+	if (NULL != entry) {
+		if ((now - entry->validatedAtMillis) < _checkIntervalMillis) {
+			found = true;
+		} else if (-1 != entry->watchDescriptor) {
+			readWatchEvents(currentThread, now);
+			if (-1 != entry->watchDescriptor) {
+				entry->validatedAtMillis = now;
+				found = true;
+			}
+		}
+	}
+	if (found) {
+		*lastModified = entry->lastModified;
+		_timestampsAvoided += 1;
+	}
+	omrthread_monitor_exit(_validatedTimestampsMutex);
+
+	return found;
+}
+
+/**
+ * Remember a timestamp of a classpath entry just read from the filesystem.
+ *
+ * THREADING: Can be called multi-threaded
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] cpei  The classpath entry
+ * @param [in] lastModified  The timestamp read, or -1 if the entry does not exist
+ * @param [in] watchDescriptor  The inotify watch added on the entry before reading the timestamp, or -1 if it is not watched
+ */
+void
+SH_TimestampManagerImpl::storeValidatedTimestamp(J9VMThread* currentThread, ClasspathEntryItem* cpei, I_64 lastModified, IDATA watchDescriptor)
+{
+	ValidatedTimestamp query;
+	ValidatedTimestamp* entry = NULL;
+	U_16 pathLen = 0;
+	PORT_ACCESS_FROM_PORT(currentThread->javaVM->portLibrary);
+
+	query.path = (char*)cpei->getLocation(&pathLen);
+	query.pathLen = pathLen;
+
+	omrthread_monitor_enter(_validatedTimestampsMutex);
+	_timestampsChecked += 1;
+	entry = (ValidatedTimestamp*)hashTableFind(_validatedTimestamps, &query);
+	if (NULL == entry) {
+		char* pathCopy = (char*)j9mem_allocate_memory(pathLen, J9MEM_CATEGORY_CLASSES);
+
+		if (NULL != pathCopy) {
+			memcpy(pathCopy, query.path, pathLen);
+			query.path = pathCopy;
+			query.watchDescriptor = -1;
+			query.nextWatched = NULL;
+			entry = (ValidatedTimestamp*)hashTableAdd(_validatedTimestamps, &query);
+			if (NULL == entry) {
+				j9mem_free_memory(pathCopy);
+			}
+		}
+	}
+	if (NULL != entry) {
+		entry->lastModified = lastModified;
+		entry->validatedAtMillis = j9time_current_time_millis();
+		if (-1 == lastModified) {
+			/* A missing entry is checked again after checkInterval, it is not watched */
+			detachWatch(entry, false);
+		} else {
+			attachWatch(entry, watchDescriptor);
+		}
+	}
+	if ((NULL == entry) || (-1 == lastModified)) {
+		releaseUnusedWatch(watchDescriptor);
+	}
+	omrthread_monitor_exit(_validatedTimestampsMutex);
+}
+
+/**
+ * Make an entry watched by a watch descriptor, in place of the watch it had before.
+ * inotify returns the same watch descriptor for paths that refer to the same file,
+ * so several entries can share one.
+ *
+ * THREADING: Must be called with _validatedTimestampsMutex held
+ *
+ * @param [in] entry  The entry
+ * @param [in] watchDescriptor  The inotify watch on the entry, or -1 if it is not watched
+ */
+void
+SH_TimestampManagerImpl::attachWatch(ValidatedTimestamp* entry, IDATA watchDescriptor)
+{
+	if (entry->watchDescriptor == watchDescriptor) {
+		return;
+	}
+	detachWatch(entry, false);
+	if (-1 != watchDescriptor) {
+		WatchedEntries query;
+		WatchedEntries* watched = NULL;
+
+		query.watchDescriptor = watchDescriptor;
+		query.entries = NULL;
+		watched = (WatchedEntries*)hashTableAdd(_watchedEntries, &query);
+		if (NULL == watched) {
+			releaseUnusedWatch(watchDescriptor);
+		} else {
+			entry->watchDescriptor = watchDescriptor;
+			entry->nextWatched = watched->entries;
+			watched->entries = entry;
+		}
+	}
+}
+
+/**
+ * Stop watching an entry. The inotify watch is removed once no entry uses it.
+ *
+ * THREADING: Must be called with _validatedTimestampsMutex held
+ *
+ * @param [in] entry  The entry
+ * @param [in] watchRemoved  true if the kernel already removed the watch
+ */
+void
+SH_TimestampManagerImpl::detachWatch(ValidatedTimestamp* entry, bool watchRemoved)
+{
+	WatchedEntries query;
+	WatchedEntries* watched = NULL;
+
+	if (-1 == entry->watchDescriptor) {
+		return;
+	}
+	query.watchDescriptor = entry->watchDescriptor;
+	watched = (WatchedEntries*)hashTableFind(_watchedEntries, &query);
+	if (NULL != watched) {
+		ValidatedTimestamp** link = &watched->entries;
+
+		while (NULL != *link) {
+			if (entry == *link) {
+				*link = entry->nextWatched;
+				break;
+			}
+			link = &(*link)->nextWatched;
+		}
+		if (NULL == watched->entries) {
+			hashTableRemove(_watchedEntries, &query);
+			if (!watchRemoved) {
+				releaseUnusedWatch(query.watchDescriptor);
+			}
+		}
+	}
+	entry->watchDescriptor = -1;
+	entry->nextWatched = NULL;
+}
+
+/**
+ * Remove an inotify watch unless an entry uses it.
+ *
+ * THREADING: Must be called with _validatedTimestampsMutex held
+ *
+ * @param [in] watchDescriptor  The inotify watch, or -1
+ */
+void
+SH_TimestampManagerImpl::releaseUnusedWatch(IDATA watchDescriptor)
+{
+#if defined(LINUX)
+	WatchedEntries query;
+
+	query.watchDescriptor = watchDescriptor;
+	if ((-1 != watchDescriptor) && (NULL == hashTableFind(_watchedEntries, &query))) {
+		inotify_rm_watch((int)_watchFD, (int)watchDescriptor);
+	}
+#endif /* defined(LINUX) */
+}
+
+/**
+ * Invalidate the timestamps of the entries using a watch, and stop watching them.
+ * They are watched again when their timestamp is next read.
+ *
+ * THREADING: Must be called with _validatedTimestampsMutex held
+ *
+ * @param [in] watchDescriptor  The inotify watch reporting a change
+ * @param [in] watchRemoved  true if the kernel already removed the watch
+ */
+void
+SH_TimestampManagerImpl::invalidateWatchedEntries(IDATA watchDescriptor, bool watchRemoved)
+{
+	WatchedEntries query;
+	WatchedEntries* watched = NULL;
+
+	query.watchDescriptor = watchDescriptor;
+	watched = (WatchedEntries*)hashTableFind(_watchedEntries, &query);
+	while ((NULL != watched) && (NULL != watched->entries)) {
+		ValidatedTimestamp* entry = watched->entries;
+
+		entry->validatedAtMillis = 0;
+		/* Removes the watch, and the WatchedEntries, along with the last entry */
+		detachWatch(entry, watchRemoved);
+		watched = (WatchedEntries*)hashTableFind(_watchedEntries, &query);
+	}
+}
+
+/**
+ * Drain pending inotify events and invalidate the watched entries they refer to.
+ * Events are read at most once per checkInterval, which bounds how late a change is noticed.
+ *
+ * THREADING: Must be called with _validatedTimestampsMutex held
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] now  The current time in milliseconds
+ */
+void
+SH_TimestampManagerImpl::readWatchEvents(J9VMThread* currentThread, I_64 now)
+{
+#if defined(LINUX)
+	if ((now - _lastWatchReadMillis) < _checkIntervalMillis) {
+		return;
+	}
+	_lastWatchReadMillis = now;
 
+	for (;;) {
+		char buffer[TSM_WATCH_EVENT_BUFFER_SIZE] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+		ssize_t length = read((int)_watchFD, buffer, sizeof(buffer));
+		char* cursor = buffer;
+
+		if (length <= 0) {
+			/* EAGAIN: no more events */
+			break;
+		}
+		while (cursor < (buffer + length)) {
+			struct inotify_event* event = (struct inotify_event*)cursor;
+
+			if (J9_ARE_ANY_BITS_SET(event->mask, IN_Q_OVERFLOW)) {
+				/* Events were lost, so invalidate every watched entry */
+				J9HashTableState walkState;
+				ValidatedTimestamp* entry = (ValidatedTimestamp*)hashTableStartDo(_validatedTimestamps, &walkState);
+
+				while (NULL != entry) {
+					if (-1 != entry->watchDescriptor) {
+						entry->validatedAtMillis = 0;
+						detachWatch(entry, false);
+					}
+					entry = (ValidatedTimestamp*)hashTableNextDo(&walkState);
+				}
+			} else {
+				/* IN_IGNORED reports a watch the kernel removed, after the file was deleted or the watch released */
+				invalidateWatchedEntries((IDATA)event->wd, J9_ARE_ANY_BITS_SET(event->mask, IN_IGNORED));
+			}
+			Trc_SHR_TMI_readWatchEvents_Event(currentThread, event->wd, event->mask);
+			cursor += sizeof(struct inotify_event) + event->len;
+		}
+	}
+#endif /* defined(LINUX) */
+}
+
+UDATA
+SH_TimestampManagerImpl::vtHashFn(void* item, void *userData)
+{
+	ValidatedTimestamp* entry = (ValidatedTimestamp*)item;
+	J9InternalVMFunctions* internalFunctionTable = (J9InternalVMFunctions*)userData;
+
+	return internalFunctionTable->computeHashForUTF8((U_8*)entry->path, entry->pathLen);
+}
+
+UDATA
+SH_TimestampManagerImpl::vtHashEqualFn(void* left, void* right, void *userData)
+{
+	ValidatedTimestamp* leftEntry = (ValidatedTimestamp*)left;
+	ValidatedTimestamp* rightEntry = (ValidatedTimestamp*)right;
+
+	return (leftEntry->pathLen == rightEntry->pathLen) && (0 == memcmp(leftEntry->path, rightEntry->path, leftEntry->pathLen));
+}
+
+UDATA
+SH_TimestampManagerImpl::weHashFn(void* item, void *userData)
+{
+	return (UDATA)((WatchedEntries*)item)->watchDescriptor;
+}
+
+UDATA
+SH_TimestampManagerImpl::weHashEqualFn(void* left, void* right, void *userData)
+{
+	return ((WatchedEntries*)left)->watchDescriptor == ((WatchedEntries*)right)->watchDescriptor;
+}
+
+UDATA
+SH_TimestampManagerImpl::vtFreeFn(void* entry, void* userData)
+{
+	PORT_ACCESS_FROM_PORT((J9PortLibrary*)userData);
+
+	j9mem_free_memory(((ValidatedTimestamp*)entry)->path);
+	return TRUE;
+}
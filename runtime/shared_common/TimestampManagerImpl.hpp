@@ -56,10 +56,69 @@ public:
 	/* @see TimestampManager.hpp */
 	virtual I_64 checkROMClassTimeStamp(J9VMThread* currentThread, const char* className, UDATA classNameLen, ClasspathEntryItem* cpei, ROMClassWrapper* rcWrapper);
 
+	/* @see TimestampManager.hpp */
+	virtual void getTimestampCheckCounts(UDATA* checked, UDATA* avoided);
+
+	/* @see TimestampManager.hpp */
+	virtual void cleanup(J9VMThread* currentThread);
+
 private:
+	/*
+	 * A classpath entry timestamp read from the filesystem, reused until checkInterval
+	 * has passed or, on Linux, until inotify reports a change to the entry.
+	 */
+	typedef struct ValidatedTimestamp {
+		char* path;
+		UDATA pathLen;
+		I_64 lastModified;
+		I_64 validatedAtMillis;
+		IDATA watchDescriptor;
+		struct ValidatedTimestamp* nextWatched; /* next entry sharing the same watch, when paths refer to the same file */
+	} ValidatedTimestamp;
+
+	/*
+	 * The entries watched by one inotify watch descriptor
+	 */
+	typedef struct WatchedEntries {
+		IDATA watchDescriptor;
+		ValidatedTimestamp* entries;
+	} WatchedEntries;
 
 	I_64 localCheckTimeStamp(J9VMThread* currentThread, ClasspathEntryItem* cpei, const char* className, UDATA classNameLen, ROMClassWrapper* rcWrapper);
+
+	bool findValidatedTimestamp(J9VMThread* currentThread, ClasspathEntryItem* cpei, I_64* lastModified);
+
+	void storeValidatedTimestamp(J9VMThread* currentThread, ClasspathEntryItem* cpei, I_64 lastModified, IDATA watchDescriptor);
+
+	void readWatchEvents(J9VMThread* currentThread, I_64 now);
+
+	void attachWatch(ValidatedTimestamp* entry, IDATA watchDescriptor);
+
+	void detachWatch(ValidatedTimestamp* entry, bool watchRemoved);
+
+	void releaseUnusedWatch(IDATA watchDescriptor);
+
+	void invalidateWatchedEntries(IDATA watchDescriptor, bool watchRemoved);
+
+	static UDATA weHashFn(void* item, void *userData);
+
+	static UDATA weHashEqualFn(void* left, void* right, void *userData);
+
+	static UDATA vtHashFn(void* item, void *userData);
+
+	static UDATA vtHashEqualFn(void* left, void* right, void *userData);
+
+	static UDATA vtFreeFn(void* entry, void* userData);
+
 	J9SharedClassConfig* _sharedClassConfig;
+	J9HashTable* _validatedTimestamps;
+	J9HashTable* _watchedEntries;
+	omrthread_monitor_t _validatedTimestampsMutex;
+	I_64 _checkIntervalMillis;
+	I_64 _lastWatchReadMillis;
+	IDATA _watchFD;
+	UDATA _timestampsChecked;
+	UDATA _timestampsAvoided;
 };
 
 #endif /* !defined(TIMESTAMPMANAGERIMPL_HPP_INCLUDED) */
@@ -231,6 +231,10 @@ J9SharedClassesHelpText J9SHAREDCLASSESHELPTEXT[] = {
 	{HELPTEXT_MPROTECTEQUALS_PARTIAL_PAGES_PRIVATE_OPTION, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_MPROTECT_PARTIAL_PAGES},
 	{HELPTEXT_MPROTECTEQUALS_PARTIAL_PAGES_ON_STARTUP_PRIVATE_OPTION, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_MPROTECT_PARTIAL_PAGES_ON_STARTUP},
 #endif
+#if defined(LINUX)
+	{OPTION_MMAP_HUGE_PAGES, J9NLS_SHRC_SHRINIT_HELPTEXT_MMAP_HUGE_PAGES, 0, 0},
+	{OPTION_MMAP_PREFAULT, J9NLS_SHRC_SHRINIT_HELPTEXT_MMAP_PREFAULT, 0, 0},
+#endif /* defined(LINUX) */
 	{OPTION_CACHERETRANSFORMED, J9NLS_SHRC_SHRINIT_HELPTEXT_CACHERETRANSFORMED, 0, 0},
 	{OPTION_NOBOOTCLASSPATH, J9NLS_SHRC_SHRINIT_HELPTEXT_NOBOOTCLASSPATH_V1, 0, 0},
 	{OPTION_BOOTCLASSESONLY, J9NLS_SHRC_SHRINIT_HELPTEXT_BOOTCLASSESONLY, 0, 0},
@@ -249,6 +253,7 @@ J9SharedClassesHelpText J9SHAREDCLASSESHELPTEXT[] = {
 	{HELPTEXT_ADJUST_MAXAOT_EQUALS, J9NLS_SHRC_SHRINIT_HELPTEXT_ADJUST_MAXAOT_EQUALS, 0, 0},
 	{HELPTEXT_ADJUST_MINJITDATA_EQUALS, J9NLS_SHRC_SHRINIT_HELPTEXT_ADJUST_MINJIT_EQUALS, 0, 0},
 	{HELPTEXT_ADJUST_MAXJITDATA_EQUALS, J9NLS_SHRC_SHRINIT_HELPTEXT_ADJUST_MAXJIT_EQUALS, 0, 0},
+	{HELPTEXT_COMPRESS_BYTE_DATA_EQUALS, J9NLS_SHRC_SHRINIT_HELPTEXT_COMPRESS_BYTE_DATA_EQUALS, 0, 0},
 #if defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE)
 	HELPTEXT_NEWLINE,
 	{HELPTEXT_LAYER_EQUALS,J9NLS_SHRC_SHRINIT_HELPTEXT_LAYER_EQUALS, 0, 0},
@@ -256,6 +261,7 @@ J9SharedClassesHelpText J9SHAREDCLASSESHELPTEXT[] = {
 #endif /* J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE */
 	{OPTION_NO_TIMESTAMP_CHECKS, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_TIMESTAMP_CHECKS_V1, 0, 0},
 	{OPTION_NO_URL_TIMESTAMP_CHECK, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_URL_TIMESTAMP_CHECK},
+	{HELPTEXT_TIMESTAMP_CHECK_INTERVAL_EQUALS, J9NLS_SHRC_SHRINIT_HELPTEXT_TIMESTAMP_CHECK_INTERVAL_EQUALS, 0, 0},
 	{OPTION_URL_TIMESTAMP_CHECK, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_URL_TIMESTAMP_CHECK},
 	{OPTION_NO_CLASSPATH_CACHEING, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_CLASSPATH_CACHEING},
 	{OPTION_NO_REDUCE_STORE_CONTENTION, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_REDUCE_STORE_CONTENTION},
@@ -376,6 +382,12 @@ J9SharedClassesOptions J9SHAREDCLASSESOPTIONS[] = {
 	{ OPTION_CREATE_LAYER, PARSE_TYPE_EXACT, RESULT_DO_CREATE_LAYER, 0 },
 #endif /* defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE) */
 	{ OPTION_NO_PERSISTENT_DISK_SPACE_CHECK, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG, J9SHR_RUNTIMEFLAG_NO_PERSISTENT_DISK_SPACE_CHECK},
+	{ OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_TIMESTAMP_CHECK_INTERVAL_EQUALS, 0 },
+	{ OPTION_COMPRESS_BYTE_DATA_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_COMPRESS_BYTE_DATA_EQUALS, 0 },
+#if defined(LINUX)
+	{ OPTION_MMAP_HUGE_PAGES, PARSE_TYPE_EXACT, RESULT_DO_MMAP_HUGE_PAGES, 0 },
+	{ OPTION_MMAP_PREFAULT, PARSE_TYPE_EXACT, RESULT_DO_MMAP_PREFAULT, 0 },
+#endif /* defined(LINUX) */
 	{ NULL, 0, 0 }
 };
 
@@ -687,6 +699,44 @@ parseArgs(J9JavaVM* vm, char* options, U_64* runtimeFlags, UDATA* verboseFlags,
 			options += strlen(OPTION_LAYER_EQUALS)+ (cursor - layerString) +1;
 			continue;
 		}
+		case RESULT_DO_TIMESTAMP_CHECK_INTERVAL_EQUALS:
+		{
+			UDATA temp = 0;
+			char* intervalString = options + strlen(OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS);
+			char* cursor = intervalString;
+			if ((scan_udata(&cursor, &temp) == 0)
+				&& (temp <= U_32_MAX)
+			) {
+				vm->sharedCacheAPI->timestampCheckIntervalMillis = (U_32)temp;
+			} else {
+				SHRINIT_ERR_TRACE2(1, J9NLS_SHRC_SHRINIT_OPTION_INVALID_TIMESTAMP_CHECK_INTERVAL, intervalString, OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS);
+				return RESULT_PARSE_FAILED;
+			}
+			options += strlen(OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS)+ (cursor - intervalString) +1;
+			continue;
+		}
+		case RESULT_DO_COMPRESS_BYTE_DATA_EQUALS:
+		{
+			UDATA minBytes = 0;
+			char* sizeString = options + strlen(OPTION_COMPRESS_BYTE_DATA_EQUALS);
+			BOOLEAN parseSize = j9shr_parseMemSize(sizeString, minBytes);
+
+			if ((FALSE == parseSize) || (minBytes > I_32_MAX)) {
+				SHRINIT_ERR_TRACE1(1, J9NLS_SHRC_SHRINIT_OPTION_INVALID_MEMORY_SIZE, options);
+				return RESULT_PARSE_FAILED;
+			}
+			vm->sharedCacheAPI->compressByteDataMinBytes = (U_32)minBytes;
+			options += strlen(OPTION_COMPRESS_BYTE_DATA_EQUALS) + strlen(sizeString) + 1;
+			continue;
+		}
+#if defined(LINUX)
+		case RESULT_DO_MMAP_HUGE_PAGES:
+			vm->sharedCacheAPI->mmapFlags |= J9SHR_MMAP_FLAG_HUGE_PAGES;
+			break;
+		case RESULT_DO_MMAP_PREFAULT:
+			vm->sharedCacheAPI->mmapFlags |= J9SHR_MMAP_FLAG_PREFAULT;
+			break;
+#endif /* defined(LINUX) */
 		case RESULT_DO_CREATE_LAYER:
 		{
 			vm->sharedCacheAPI->layer = SHRINIT_CREATE_NEW_LAYER;
@@ -1995,17 +2045,19 @@ j9shr_storeAttachedData(J9VMThread* currentThread, const void* addressInCache, c
 		return J9SHR_RESOURCE_STORE_ERROR;
 	}
 
-	if (localRuntimeFlags & J9SHR_RUNTIMEFLAG_JIT_SPACE_FULL) {
-		Trc_SHR_INIT_storeAttachedData_exit_CacheFull(currentThread);
-		return J9SHR_RESOURCE_STORE_FULL;
-	}
-
 	if ((J9SHR_ATTACHED_DATA_TYPE_JITPROFILE != data->type)
-		&& (J9SHR_ATTACHED_DATA_TYPE_JITHINT != data->type)) {
+		&& (J9SHR_ATTACHED_DATA_TYPE_JITHINT != data->type)
+		&& (J9SHR_ATTACHED_DATA_TYPE_CLASSPROFILE != data->type)) {
 		Trc_SHR_INIT_storeAttachedData_exit_TypeUnknown(currentThread, data->type);
 		return J9SHR_RESOURCE_PARAMETER_ERROR;
 	}
 
+	/* Class profiles are VM data kept in the block data area, not in the JIT area */
+	if (localRuntimeFlags & ((J9SHR_ATTACHED_DATA_TYPE_CLASSPROFILE == data->type) ? J9SHR_RUNTIMEFLAG_BLOCK_SPACE_FULL : J9SHR_RUNTIMEFLAG_JIT_SPACE_FULL)) {
+		Trc_SHR_INIT_storeAttachedData_exit_CacheFull(currentThread);
+		return J9SHR_RESOURCE_STORE_FULL;
+	}
+
 	if (J9SHR_ATTACHED_DATA_NO_FLAGS != data->flags) {
 		Trc_SHR_INIT_storeAttachedData_exit_FlagErr(currentThread, data->flags);
 		return J9SHR_RESOURCE_PARAMETER_ERROR;
@@ -3721,6 +3773,11 @@ j9shr_init(J9JavaVM *vm, UDATA loadFlags, UDATA* nonfatal)
 
 	vm->sharedClassConfig->runtimeFlags |= J9SHR_RUNTIMEFLAG_CACHE_INITIALIZATION_COMPLETE;
 
+	if (J9VMDLLMAIN_OK == returnVal) {
+		/* Read ahead the pages that previous JVMs used during startup, and record the ones this JVM uses */
+		((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->startStartupAccessProfile(currentThread);
+	}
+
 	if (RESULT_DO_SNAPSHOTCACHE == parseResult) {
 		*nonfatal = 0;
 		if (0 == j9shr_createCacheSnapshot(vm, cacheName)) {
@@ -4917,6 +4974,7 @@ j9shr_jvmPhaseChange(J9VMThread *currentThread, UDATA phase)
 		/* OpenJ9 issue; https://github.com/eclipse-openj9/openj9/issues/3743
 		 * GC decides whether to calls vm->sharedClassConfig->storeGCHints() to store the GC hints into the shared cache. */
 		storeStartupHintsToSharedCache(currentThread);
+		((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->storeStartupAccessProfile(currentThread);
 		if (J9_ARE_NO_BITS_SET(vm->sharedClassConfig->runtimeFlags, J9SHR_RUNTIMEFLAG_MPROTECT_PARTIAL_PAGES_ON_STARTUP)) {
 			((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->protectPartiallyFilledPages(currentThread);
 		}
@@ -194,6 +194,10 @@ typedef struct J9SharedClassesOptions {
 #define OPTION_LAYER_EQUALS "layer="
 #define OPTION_CREATE_LAYER "createLayer"
 #define OPTION_NO_PERSISTENT_DISK_SPACE_CHECK "noPersistentDiskSpaceCheck"
+#define OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS "timestampCheckInterval="
+#define OPTION_COMPRESS_BYTE_DATA_EQUALS "compressByteData="
+#define OPTION_MMAP_HUGE_PAGES "mmapHugePages"
+#define OPTION_MMAP_PREFAULT "mmapPrefault"
 
 /* public options for printallstats= and printstats=  */
 #define SUB_OPTION_PRINTSTATS_ALL "all"
@@ -274,6 +278,10 @@ typedef struct J9SharedClassesOptions {
 #define RESULT_DO_CREATE_LAYER 52
 #define RESULT_DO_PRINT_TOP_LAYER_STATS 53
 #define RESULT_DO_PRINT_TOP_LAYER_STATS_EQUALS 54
+#define RESULT_DO_TIMESTAMP_CHECK_INTERVAL_EQUALS 55
+#define RESULT_DO_COMPRESS_BYTE_DATA_EQUALS 56
+#define RESULT_DO_MMAP_HUGE_PAGES 57
+#define RESULT_DO_MMAP_PREFAULT 58
 
 #define PARSE_TYPE_EXACT 1
 #define PARSE_TYPE_STARTSWITH 2
@@ -306,6 +314,8 @@ typedef struct J9SharedClassesOptions {
 #define HELPTEXT_ADJUST_MINJITDATA_EQUALS OPTION_ADJUST_MINJITDATA_EQUALS"<size>"
 #define HELPTEXT_ADJUST_MAXJITDATA_EQUALS OPTION_ADJUST_MAXJITDATA_EQUALS"<size>"
 #define HELPTEXT_LAYER_EQUALS OPTION_LAYER_EQUALS "<number>"
+#define HELPTEXT_TIMESTAMP_CHECK_INTERVAL_EQUALS OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS "<ms>"
+#define HELPTEXT_COMPRESS_BYTE_DATA_EQUALS OPTION_COMPRESS_BYTE_DATA_EQUALS "<size>"
 
 #define HELPTEXT_NEWLINE {"", 0, 0, 0, 0}
 
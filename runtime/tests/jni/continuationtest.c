@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+#include "jnitest_internal.h"
+#include "j9.h"
+
+/**
+ * Mount a continuation, create a local ref on its stack, then unmount it. The thread must get
+ * back its own stack and monitor and JNI state, and the ref must still be found on the
+ * continuation stack when it is mounted again. VM access is held throughout, as the
+ * collectors do not scan continuations.
+ */
+jboolean JNICALL
+Java_j9vm_test_jni_ContinuationMountTest_mountAndUnmount(JNIEnv *env, jclass clazz, jobject obj)
+{
+	J9VMThread *vmThread = (J9VMThread *)env;
+	J9InternalVMFunctions *vmFuncs = vmThread->javaVM->internalVMFunctions;
+	J9VMContinuation *continuation = NULL;
+	J9JavaStack *stack = NULL;
+	UDATA *sp = NULL;
+	UDATA *arg0EA = NULL;
+	J9JavaStack *stackObject = NULL;
+	J9MonitorEnterRecord *monitorEnterRecords = NULL;
+	J9MonitorEnterRecord *jniMonitorEnterRecords = NULL;
+	UDATA *jniLocalReferences = NULL;
+	jobject heldObj = NULL;
+	j9object_t object = NULL;
+	jboolean rc = JNI_TRUE;
+
+	vmFuncs->internalEnterVMFromJNI(vmThread);
+	object = J9_JNI_UNWRAP_REFERENCE(obj);
+	continuation = vmFuncs->createContinuation(vmThread, 0);
+	if (NULL == continuation) {
+		vmFuncs->internalExitVMToJNI(vmThread);
+		return JNI_FALSE;
+	}
+	stack = continuation->stackObject;
+	sp = vmThread->sp;
+	arg0EA = vmThread->arg0EA;
+	stackObject = vmThread->stackObject;
+	monitorEnterRecords = vmThread->monitorEnterRecords;
+	jniMonitorEnterRecords = vmThread->jniMonitorEnterRecords;
+	jniLocalReferences = vmThread->jniLocalReferences;
+
+	if (!vmFuncs->mountContinuation(vmThread, continuation)) {
+		rc = JNI_FALSE;
+	} else {
+		/* The mounted continuation starts with its own stack and no monitors or JNI reference frames */
+		if ((stack != vmThread->stackObject)
+			|| (NULL != vmThread->monitorEnterRecords)
+			|| (NULL != vmThread->jniMonitorEnterRecords)
+			|| (NULL != vmThread->jniLocalReferences)
+		) {
+			rc = JNI_FALSE;
+		}
+		/* A continuation does not nest */
+		if (vmFuncs->mountContinuation(vmThread, continuation)) {
+			rc = JNI_FALSE;
+		}
+		/* Local refs created while the continuation is mounted are pushed on its stack */
+		heldObj = vmFuncs->j9jni_createLocalRef(env, object);
+		if (continuation != vmFuncs->unmountContinuation(vmThread)) {
+			rc = JNI_FALSE;
+		}
+	}
+
+	if ((sp != vmThread->sp)
+		|| (arg0EA != vmThread->arg0EA)
+		|| (stackObject != vmThread->stackObject)
+		|| (monitorEnterRecords != vmThread->monitorEnterRecords)
+		|| (jniMonitorEnterRecords != vmThread->jniMonitorEnterRecords)
+		|| (jniLocalReferences != vmThread->jniLocalReferences)
+		|| (NULL != vmThread->currentContinuation)
+	) {
+		rc = JNI_FALSE;
+	}
+	if ((NULL == heldObj) || ((UDATA *)heldObj < (UDATA *)(stack + 1)) || ((UDATA *)heldObj >= stack->end)) {
+		rc = JNI_FALSE;
+	} else if (vmFuncs->mountContinuation(vmThread, continuation)) {
+		if (*(j9object_t *)heldObj != object) {
+			rc = JNI_FALSE;
+		}
+		vmFuncs->unmountContinuation(vmThread);
+	} else {
+		rc = JNI_FALSE;
+	}
+
+	if (NULL == vmThread->currentContinuation) {
+		vmFuncs->freeContinuation(vmThread, continuation);
+	}
+	vmFuncs->internalExitVMToJNI(vmThread);
+
+	return rc;
+}
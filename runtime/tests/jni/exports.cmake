@@ -24,10 +24,17 @@ omr_add_exports(j9ben
 	JNI_OnLoad
 	JNI_OnUnload
 	Java_j9vm_test_jni_GetObjectRefTypeTest_getObjectRefTypeTest
+	Java_j9vm_test_jni_ContinuationMountTest_mountAndUnmount
 	Java_jvmti_test_nativeMethodPrefixes_UnwrappedNative_nat
 	Java_jvmti_test_nativeMethodPrefixes_DirectNative_gac4gac3gac2gac1nat
 	Java_jvmti_test_nativeMethodPrefixes_WrappedNative_nat
 	Java_jit_test_vich_JNIObjectArray_getObjectArrayElement
+	Java_jit_test_vich_JNIGlobalRef_newDeleteGlobalRef
+	Java_jit_test_vich_JNIGlobalRef_newDeleteWeakGlobalRef
+	Java_jit_test_vich_JNIGlobalRef_newDeleteGlobalRefBatch
+	Java_jit_test_vich_JNIGlobalRef_checkInterleavedGlobalRefs
+	Java_jit_test_vich_JNIMethodLookup_getMethodID
+	Java_jit_test_vich_JNIMethodLookup_getStaticMethodID
 	Java_jit_test_vich_JNILocalRef_localReference32
 	Java_jit_test_vich_JNILocalRef_localReference8
 	Java_jit_test_vich_JNIArray_getPrimitiveArrayCritical
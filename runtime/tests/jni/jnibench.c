@@ -3728,3 +3728,156 @@ void JNICALL Java_jit_test_vich_JNIObjectArray_getObjectArrayElement(JNIEnv *env
 
 
 
+void JNICALL Java_jit_test_vich_JNIGlobalRef_newDeleteGlobalRef(JNIEnv *env, jobject recv, jobject obj, jint loopCount)
+{
+	jint i;
+
+	for (i = 0; i < loopCount; i++) {
+		jobject ref = (*env)->NewGlobalRef(env, obj);
+		if (ref == NULL) return;
+		(*env)->DeleteGlobalRef(env, ref);
+	}
+	return;
+}
+
+
+void JNICALL Java_jit_test_vich_JNIGlobalRef_newDeleteWeakGlobalRef(JNIEnv *env, jobject recv, jobject obj, jint loopCount)
+{
+	jint i;
+
+	for (i = 0; i < loopCount; i++) {
+		jweak ref = (*env)->NewWeakGlobalRef(env, obj);
+		if (ref == NULL) return;
+		(*env)->DeleteWeakGlobalRef(env, ref);
+	}
+	return;
+}
+
+
+void JNICALL Java_jit_test_vich_JNIGlobalRef_newDeleteGlobalRefBatch(JNIEnv *env, jobject recv, jobject obj, jint loopCount)
+{
+	jint i, j;
+	jobject batch[64];
+
+	/* hold many refs at once and delete them in creation order, so that slots are not simply reused */
+	for (i = 0; i < loopCount; i++) {
+		for (j = 0; j < 64; j++) {
+			batch[j] = (*env)->NewGlobalRef(env, obj);
+			if (batch[j] == NULL) return;
+		}
+		for (j = 0; j < 64; j++) {
+			(*env)->DeleteGlobalRef(env, batch[j]);
+		}
+	}
+	return;
+}
+
+
+jboolean JNICALL Java_jit_test_vich_JNIGlobalRef_checkInterleavedGlobalRefs(JNIEnv *env, jobject recv, jobjectArray objs, jint loopCount)
+{
+	jint i, j;
+	jobject refs[64];
+	jboolean result = JNI_TRUE;
+	jsize count = (*env)->GetArrayLength(env, objs);
+
+	if (count > 64) count = 64;
+
+	/* even entries hold global refs, odd entries weak global refs, to the objects in objs */
+	for (j = 0; j < count; j++) {
+		jobject obj = (*env)->GetObjectArrayElement(env, objs, j);
+		refs[j] = (j & 1) ? (*env)->NewWeakGlobalRef(env, obj) : (*env)->NewGlobalRef(env, obj);
+		(*env)->DeleteLocalRef(env, obj);
+		if (refs[j] == NULL) return JNI_FALSE;
+	}
+
+	for (i = 0; i < loopCount; i++) {
+		/* delete a different third of the refs each time and recreate them in reverse order, so that slots are reused out of order */
+		for (j = 0; j < count; j++) {
+			if (((i + j) % 3) == 0) {
+				if (j & 1) {
+					(*env)->DeleteWeakGlobalRef(env, refs[j]);
+				} else {
+					(*env)->DeleteGlobalRef(env, refs[j]);
+					/* a ref deleted twice must not be cached twice */
+					(*env)->DeleteGlobalRef(env, refs[j]);
+				}
+			}
+		}
+		for (j = count - 1; j >= 0; j--) {
+			if (((i + j) % 3) == 0) {
+				jobject obj = (*env)->GetObjectArrayElement(env, objs, j);
+				refs[j] = (j & 1) ? (*env)->NewWeakGlobalRef(env, obj) : (*env)->NewGlobalRef(env, obj);
+				(*env)->DeleteLocalRef(env, obj);
+				if (refs[j] == NULL) return JNI_FALSE;
+			}
+		}
+		/* deleting a live ref as the wrong kind must leave it alone */
+		if (count > 1) {
+			(*env)->DeleteWeakGlobalRef(env, refs[0]);
+			(*env)->DeleteGlobalRef(env, refs[1]);
+		}
+		for (j = 0; j < count; j++) {
+			jobject obj = (*env)->GetObjectArrayElement(env, objs, j);
+			if (!(*env)->IsSameObject(env, refs[j], obj)) {
+				result = JNI_FALSE;
+			}
+			(*env)->DeleteLocalRef(env, obj);
+		}
+		if (result == JNI_FALSE) break;
+	}
+
+	for (j = 0; j < count; j++) {
+		if (j & 1) {
+			(*env)->DeleteWeakGlobalRef(env, refs[j]);
+		} else {
+			(*env)->DeleteGlobalRef(env, refs[j]);
+		}
+	}
+	return result;
+}
+
+
+jboolean JNICALL Java_jit_test_vich_JNIMethodLookup_getMethodID(JNIEnv *env, jobject recv, jclass clazz, jstring name, jstring sig, jint loopCount)
+{
+	jint i;
+	jboolean result = JNI_TRUE;
+	const char *nameChars = (*env)->GetStringUTFChars(env, name, NULL);
+	const char *sigChars = (*env)->GetStringUTFChars(env, sig, NULL);
+
+	if ((nameChars == NULL) || (sigChars == NULL)) return JNI_FALSE;
+
+	for (i = 0; i < loopCount; i++) {
+		if ((*env)->GetMethodID(env, clazz, nameChars, sigChars) == NULL) {
+			(*env)->ExceptionClear(env);
+			result = JNI_FALSE;
+			break;
+		}
+	}
+
+	(*env)->ReleaseStringUTFChars(env, sig, sigChars);
+	(*env)->ReleaseStringUTFChars(env, name, nameChars);
+	return result;
+}
+
+
+jboolean JNICALL Java_jit_test_vich_JNIMethodLookup_getStaticMethodID(JNIEnv *env, jobject recv, jclass clazz, jstring name, jstring sig, jint loopCount)
+{
+	jint i;
+	jboolean result = JNI_TRUE;
+	const char *nameChars = (*env)->GetStringUTFChars(env, name, NULL);
+	const char *sigChars = (*env)->GetStringUTFChars(env, sig, NULL);
+
+	if ((nameChars == NULL) || (sigChars == NULL)) return JNI_FALSE;
+
+	for (i = 0; i < loopCount; i++) {
+		if ((*env)->GetStaticMethodID(env, clazz, nameChars, sigChars) == NULL) {
+			(*env)->ExceptionClear(env);
+			result = JNI_FALSE;
+			break;
+		}
+	}
+
+	(*env)->ReleaseStringUTFChars(env, sig, sigChars);
+	(*env)->ReleaseStringUTFChars(env, name, nameChars);
+	return result;
+}
@@ -2152,6 +2152,11 @@ Java_j9vm_test_jni_CriticalRegionTest_acquireAndCallIn(JNIEnv * env, jclass claz
 jboolean JNICALL
 Java_j9vm_test_jni_CriticalRegionTest_acquireDiscardAndGC(JNIEnv * env, jclass clazz, jbyteArray array, jlongArray addresses);
 
+/* ---------------- continuationtest.c ---------------- */
+
+jboolean JNICALL
+Java_j9vm_test_jni_ContinuationMountTest_mountAndUnmount(JNIEnv *env, jclass clazz, jobject obj);
+
 
 #ifdef __cplusplus
 }
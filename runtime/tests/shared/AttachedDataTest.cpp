@@ -32,6 +32,8 @@ extern "C"
 
 #define FIND_ATTACHED_DATA_RETRY_COUNT 1
 #define MAIN_THREAD_WAIT_TIME 1
+#define CONCURRENT_READER_COUNT 4
+#define CONCURRENT_WRITE_COUNT 64
 
 #define J9THREAD_PROC
 
@@ -49,6 +51,7 @@ extern "C" {
 	IDATA createThread(J9JavaVM *vm, omrthread_t *osThread, J9VMThread **vmThread, omrthread_entrypoint_t entryPoint, void *entryArg);
 	int J9THREAD_PROC startReader(void *entryArg);
 	int J9THREAD_PROC startWriter(void *entryArg);
+	int J9THREAD_PROC startConcurrentReader(void *entryArg);
 	IDATA testAttachedData(J9JavaVM* vm);
 }
 
@@ -88,6 +91,8 @@ public:
 	IDATA UpdateAttachedUDATAFailure(J9JavaVM *vm);
 	IDATA UpdateJitHint(J9JavaVM *vm);
 	IDATA CorruptAttachedData(J9JavaVM *vm);
+	IDATA UpdateAttachedDataUniform(J9JavaVM *vm, U_8 value);
+	IDATA FindConsistentAttachedData(J9JavaVM *vm);
 	J9ROMMethod* addMethodToCache(J9JavaVM *vm);
 
 	bool isThreadSuspended(void);
@@ -1400,6 +1405,96 @@ _exit:
 	return rc;
 }
 
+/**
+ * Overwrite all of dataList[1] in the cache with the same byte value. The update locks the cache,
+ * so a reader must never see a mix of two values.
+ */
+IDATA
+AttachedDataTest::UpdateAttachedDataUniform(J9JavaVM *vm, U_8 value)
+{
+	IDATA rc = PASS;
+	J9VMThread *currentThread = vm->internalVMFunctions->currentVMThread(vm);
+	J9SharedDataDescriptor data;
+	const char *testName = "UpdateAttachedDataUniform";
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	data.length = dataList[1].data.length;
+	data.type = dataList[1].data.type;
+	data.flags = dataList[1].data.flags;
+	data.address = (U_8 *)j9mem_allocate_memory(data.length, J9MEM_CATEGORY_CLASSES);
+	if (NULL == data.address) {
+		ERRPRINTF("failed to allocate memory for update data");
+		return FAIL;
+	}
+	memset(data.address, value, data.length);
+
+	if (0 != vm->sharedClassConfig->updateAttachedData(currentThread, dataList[1].keyAddress, 0, &data)) {
+		ERRPRINTF1("j9shr_updateAttachedData failed to update the data to value %d", value);
+		rc = FAIL;
+	}
+
+	j9mem_free_memory(data.address);
+	return rc;
+}
+
+/**
+ * Find all the data in dataList, and check that it is consistent: dataList[1] is updated by
+ * UpdateAttachedDataUniform() and must hold a single byte value, the other data never changes.
+ */
+IDATA
+AttachedDataTest::FindConsistentAttachedData(J9JavaVM *vm)
+{
+	IDATA rc = PASS;
+	I_32 i;
+	J9VMThread *currentThread = vm->internalVMFunctions->currentVMThread(vm);
+	const char *testName = "FindConsistentAttachedData";
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	for (i = 0; (i < NUM_DATA_OBJECTS) && (PASS == rc); i++) {
+		J9SharedDataDescriptor data;
+		IDATA corruptOffset = -1;
+		const U_8 *found = NULL;
+
+		memset(&data, 0, sizeof(J9SharedDataDescriptor));
+		data.type = dataList[i].data.type;
+
+		found = vm->sharedClassConfig->findAttachedData(currentThread, dataList[i].keyAddress, &data, &corruptOffset);
+		if (((UDATA)found <= J9SHR_RESOURCE_MAX_ERROR_VALUE) || (-1 != corruptOffset)) {
+			ERRPRINTF3("j9shr_findAttachedData returned %p, corruptOffset %d for data index: %d", found, corruptOffset, i);
+			rc = FAIL;
+		} else if (data.length != dataList[i].data.length) {
+			ERRPRINTF3("j9shr_findAttachedData found length %d, expected %d for data index: %d", data.length, dataList[i].data.length, i);
+			rc = FAIL;
+		} else if (1 == i) {
+			UDATA j;
+			for (j = 1; j < data.length; j++) {
+				if (found[j] != found[0]) {
+					ERRPRINTF2("j9shr_findAttachedData found a partial update, byte %d differs from byte 0 (%d)", j, found[0]);
+					rc = FAIL;
+					break;
+				}
+			}
+		} else if (0 != memcmp(found, dataList[i].data.address, data.length)) {
+			ERRPRINTF1("j9shr_findAttachedData found incorrect data for data index: %d", i);
+			rc = FAIL;
+		}
+		if (NULL != data.address) {
+			vm->sharedClassConfig->freeAttachedDataDescriptor(currentThread, &data);
+		}
+	}
+	return rc;
+}
+
+struct ConcurrentReader {
+	AttachedDataTest *adt;
+	J9JavaVM *vm;
+	omrthread_t osThread;
+	J9VMThread *vmThread;
+	volatile bool cancelThread;
+	volatile bool threadExited;
+	IDATA rc;
+};
+
 extern "C" {
 
 IDATA createThread(J9JavaVM *vm, omrthread_t *osThread, J9VMThread **vmThread, omrthread_entrypoint_t entryPoint, void *entryArg) {
@@ -1565,6 +1660,127 @@ _exitCloseCache:
 	return (int)rc;
 }
 
+/**
+ * Reader thread for testFindWithConcurrentWriter(). It finds the data without holding the cache
+ * read mutex while the cache is unlocked, racing with the writer.
+ */
+int J9THREAD_PROC
+startConcurrentReader(void *entryArg) {
+	const char *testName = "startConcurrentReader";
+	ConcurrentReader *reader = (ConcurrentReader *)entryArg;
+	J9JavaVM *vm = reader->vm;
+	J9VMThread *currentThread = vm->internalVMFunctions->currentVMThread(vm);
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	vm->internalVMFunctions->internalEnterVMFromJNI(currentThread);
+	reader->rc = PASS;
+	while ((false == reader->cancelThread) && (PASS == reader->rc)) {
+		reader->rc = reader->adt->FindConsistentAttachedData(vm);
+	}
+	vm->internalVMFunctions->internalExitVMToJNI(currentThread);
+	vm->internalVMFunctions->threadCleanup(currentThread, 0);
+	if (FAIL == reader->rc) {
+		ERRPRINTF("Reader thread found inconsistent data");
+	}
+	reader->threadExited = true;
+	return (int)reader->rc;
+}
+
+/**
+ * Readers look up attached data while this thread locks the cache to update it, and adds
+ * new data, growing the local hashtables that the readers look up without their mutex.
+ */
+IDATA
+testFindWithConcurrentWriter(J9JavaVM *vm) {
+	const char *testName = "testFindWithConcurrentWriter";
+	IDATA rc = PASS;
+	I_32 i;
+	ConcurrentReader readers[CONCURRENT_READER_COUNT];
+	AttachedDataTest adt;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	memset(readers, 0, sizeof(readers));
+
+	rc = adt.openTestCache(vm, NULL, 0, J9PORT_SHR_CACHE_TYPE_NONPERSISTENT, 0, 0);
+	if (FAIL == rc) {
+		ERRPRINTF("openTestCache failed");
+		goto _exitCloseCache;
+	}
+	/* Don't print a message for each of the many updates */
+	vm->sharedClassConfig->verboseFlags &= ~(UDATA)J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA;
+
+	rc = adt.initializeAttachedData(vm);
+	if (FAIL == rc) {
+		ERRPRINTF("initializeAttachedData failed");
+		goto _exitClearData;
+	}
+	rc = adt.StoreAttachedDataSuccess(vm);
+	if (FAIL == rc) {
+		ERRPRINTF("StoreAttachedDataSuccess failed");
+		goto _exitClearData;
+	}
+	rc = adt.UpdateAttachedDataUniform(vm, 0);
+	if (FAIL == rc) {
+		goto _exitClearData;
+	}
+
+	for (i = 0; i < CONCURRENT_READER_COUNT; i++) {
+		readers[i].adt = &adt;
+		readers[i].vm = vm;
+		rc = createThread(vm, &readers[i].osThread, &readers[i].vmThread, startConcurrentReader, &readers[i]);
+		if (FAIL == rc) {
+			ERRPRINTF("createThread failed");
+			break;
+		}
+		omrthread_resume(readers[i].osThread);
+	}
+
+	for (i = 1; (i <= CONCURRENT_WRITE_COUNT) && (PASS == rc); i++) {
+		J9SharedDataDescriptor data;
+		U_8 value = (U_8)i;
+		const void *keyAddress = adt.addMethodToCache(vm);
+
+		if (NULL == keyAddress) {
+			ERRPRINTF("addMethodToCache failed");
+			rc = FAIL;
+			break;
+		}
+		data.address = &value;
+		data.length = sizeof(value);
+		data.type = J9SHR_ATTACHED_DATA_TYPE_JITPROFILE;
+		data.flags = J9SHR_ATTACHED_DATA_NO_FLAGS;
+		if (0 != vm->sharedClassConfig->storeAttachedData(vm->internalVMFunctions->currentVMThread(vm), keyAddress, &data, false)) {
+			ERRPRINTF1("j9shr_storeAttachedData failed for write: %d", i);
+			rc = FAIL;
+			break;
+		}
+		rc = adt.UpdateAttachedDataUniform(vm, value);
+	}
+
+	for (i = 0; i < CONCURRENT_READER_COUNT; i++) {
+		if (NULL != readers[i].osThread) {
+			readers[i].cancelThread = true;
+			while (false == readers[i].threadExited) {
+				omrthread_sleep(MAIN_THREAD_WAIT_TIME);
+			}
+			if (FAIL == readers[i].rc) {
+				rc = FAIL;
+			}
+		}
+	}
+
+	if (PASS == rc) {
+		INFOPRINTF2("%d readers found consistent data during %d concurrent writes\n\t", CONCURRENT_READER_COUNT, CONCURRENT_WRITE_COUNT);
+	}
+
+_exitClearData:
+	adt.freeAttachedData(vm);
+
+_exitCloseCache:
+	adt.closeTestCache(vm, true);
+	return rc;
+}
+
 IDATA
 testFindReadOnly(J9JavaVM *vm) {
 	const char *testName = "testFindReadOnly";
@@ -1886,6 +2102,13 @@ _exitCloseCache:
 		ERRPRINTF("testFindReadOnly failed");
 	}
 
+	if (PASS == rc) {
+		rc = testFindWithConcurrentWriter(vm);
+		if (FAIL == rc) {
+			ERRPRINTF("testFindWithConcurrentWriter failed");
+		}
+	}
+
 	UnitTest::unitTest = UnitTest::NO_TEST;
 	UnitTest::cacheSize = 0;
 	UnitTest::cacheMemory = NULL;
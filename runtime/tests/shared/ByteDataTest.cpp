@@ -88,7 +88,10 @@ IDATA storeTest(J9JavaVM* currentThread, struct CachePointers* pointers);
 IDATA releaseAcquireTest(J9JavaVM* currentThread, struct CachePointers* pointers);
 SH_CacheMap* createTestCache(J9JavaVM* vm, UDATA size, char* existingCache, char** resultCache);
 IDATA checkFindResults(J9JavaVM* vm, struct CachePointers* cachePointers, UDATA testJustRun);
+IDATA compressTest(J9JavaVM* vm);
 const IDATA SMALL_CACHE_SIZE = 16384;
+const IDATA COMPRESS_CACHE_SIZE = 65536;
+const UDATA COMPRESS_DATA_SIZE = 4096;
 
 IDATA testByteDataManager(J9JavaVM* vm)
 {
@@ -119,6 +122,7 @@ IDATA testByteDataManager(J9JavaVM* vm)
 		if (storeTestResult == 0) {
 			SHC_TEST_ASSERT("ReleaseAcquire", releaseAcquireTest(vm, &cachePointers), success, rc);
 		}
+		SHC_TEST_ASSERT("Compress", compressTest(vm), success, rc);
 	} else {
 		success = FAIL;
 		j9tty_printf(PORTLIB, "Failed to initialize Byte Data Test\n");
@@ -941,3 +945,112 @@ IDATA checkFindResults(J9JavaVM* vm, struct CachePointers* cachePointers, UDATA
 	
 	return 1;
 }
+
+/**
+ * Store one piece of JCL byte data from the first cache view, and find it from the second view, which has to inflate it
+ * if it was stored compressed. Returns 0 if the data round trips and was stored compressed only if expected.
+ */
+static IDATA compressRoundTrip(J9JavaVM* vm, struct CachePointers* cachePointers, const char* key, U_8* bytes, UDATA length, bool expectCompressed)
+{
+	SH_CacheMap* testCache = NULL;
+	J9SharedDataDescriptor data;
+	J9SharedDataDescriptor found;
+	const U_8* stored = NULL;
+	IDATA resCount = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	data.address = bytes;
+	data.length = length;
+	data.type = J9SHR_DATA_TYPE_JCL;
+	data.flags = 0;
+
+	selectCache(vm, cachePointers, 1, &testCache);
+	stored = testCache->storeSharedData(vm->mainThread, key, strlen(key), &data);
+	if ((NULL == stored) || (0 != memcmp(stored, bytes, length))) {
+		j9tty_printf(PORTLIB, "Store of %s did not return the data stored\n", key);
+		return 1;
+	}
+	/* Compressed data is returned from a private uncompressed copy, uncompressed data from the cache */
+	if (expectCompressed == testCache->isAddressInCache(stored, length, false, false)) {
+		j9tty_printf(PORTLIB, "Store of %s should %sbe compressed\n", key, (expectCompressed ? "" : "not "));
+		return 1;
+	}
+
+	selectCache(vm, cachePointers, 2, &testCache);
+	memset(&found, 0, sizeof(J9SharedDataDescriptor));
+	resCount = testCache->findSharedData(vm->mainThread, key, strlen(key), J9SHR_DATA_TYPE_JCL, FALSE, &found, NULL);
+	if ((1 != resCount) || (found.length != length) || (NULL == found.address) || (0 != memcmp(found.address, bytes, length))) {
+		j9tty_printf(PORTLIB, "Find of %s from the second cache view did not return the data stored\n", key);
+		return 1;
+	}
+	if (expectCompressed == testCache->isAddressInCache(found.address, length, false, false)) {
+		j9tty_printf(PORTLIB, "Find of %s should %sreturn inflated data\n", key, (expectCompressed ? "" : "not "));
+		return 1;
+	}
+	return 0;
+}
+
+/**
+ * Round trip byte data through -Xshareclasses:compressByteData=<size>: data that compresses well,
+ * data that does not get smaller when compressed, and data below the size threshold.
+ */
+IDATA compressTest(J9JavaVM* vm)
+{
+	struct CachePointers cachePointers;
+	char* existingCachePtr = NULL;
+	U_8* bytes = NULL;
+	U_32 seed = 0x12345678;
+	U_32 savedMinBytes = 0;
+	IDATA result = 0;
+	UDATA i;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (NULL == vm->sharedCacheAPI) {
+		j9tty_printf(PORTLIB, "No shared cache API for compress test\n");
+		return 1;
+	}
+	memset(&cachePointers, 0, sizeof(cachePointers));
+	cachePointers.testCache1 = createTestCache(vm, COMPRESS_CACHE_SIZE, NULL, &existingCachePtr);
+	if (cachePointers.testCache1 && existingCachePtr) {
+		cachePointers.config1 = vm->sharedClassConfig;
+		cachePointers.preConfig1 = vm->sharedClassPreinitConfig;
+		cachePointers.testCache2 = createTestCache(vm, COMPRESS_CACHE_SIZE, existingCachePtr, &existingCachePtr);
+	}
+	if ((NULL == cachePointers.testCache1) || (NULL == cachePointers.testCache2)) {
+		j9tty_printf(PORTLIB, "Failed to create caches for compress test\n");
+		return 1;
+	}
+	cachePointers.config2 = vm->sharedClassConfig;
+	cachePointers.preConfig2 = vm->sharedClassPreinitConfig;
+
+	bytes = (U_8*)j9mem_allocate_memory(COMPRESS_DATA_SIZE, J9MEM_CATEGORY_CLASSES);
+	if (NULL == bytes) {
+		return 1;
+	}
+	savedMinBytes = vm->sharedCacheAPI->compressByteDataMinBytes;
+	vm->sharedCacheAPI->compressByteDataMinBytes = 64;
+
+	/* Repeated text compresses well */
+	for (i = 0; i < COMPRESS_DATA_SIZE; i++) {
+		bytes[i] = (U_8)data1[i % strlen(data1)];
+	}
+	result = compressRoundTrip(vm, &cachePointers, "compressKey1", bytes, COMPRESS_DATA_SIZE, true);
+
+	/* Pseudo-random bytes do not get smaller, so they are stored as is */
+	if (0 == result) {
+		for (i = 0; i < COMPRESS_DATA_SIZE; i++) {
+			seed = (seed * 1103515245) + 12345;
+			bytes[i] = (U_8)(seed >> 16);
+		}
+		result = compressRoundTrip(vm, &cachePointers, "compressKey2", bytes, COMPRESS_DATA_SIZE, false);
+	}
+
+	/* Data below the threshold is not compressed */
+	if (0 == result) {
+		result = compressRoundTrip(vm, &cachePointers, "compressKey3", (U_8*)data1, strlen(data1), false);
+	}
+
+	vm->sharedCacheAPI->compressByteDataMinBytes = savedMinBytes;
+	j9mem_free_memory(bytes);
+	return result;
+}
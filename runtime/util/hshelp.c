@@ -2392,6 +2392,34 @@ flushClassLoaderReflectCache(J9VMThread * currentThread, J9HashTable * classPair
 	}
 }
 
+/**
+ * \brief  Flush the method lookup cache of every class
+ * \ingroup
+ *
+ * @param[in] currentThread		current thread
+ * @return	none
+ *
+ *	The method lookup caches hold methods found in superclasses, which may
+ *	have been replaced or made obsolete by the redefinition. Called with
+ *	exclusive VM access, so the caches are cleared rather than freed.
+ */
+void
+flushMethodLookupCaches(J9VMThread * currentThread)
+{
+	J9JavaVM * vm = currentThread->javaVM;
+	J9InternalVMFunctions * vmFuncs = vm->internalVMFunctions;
+	J9ClassWalkState state;
+	J9Class * clazz = vmFuncs->allClassesStartDo(&state, vm, NULL);
+
+	while (NULL != clazz) {
+		if (NULL != clazz->methodLookupCache) {
+			memset(clazz->methodLookupCache, 0, sizeof(J9MethodLookupCache));
+		}
+		clazz = vmFuncs->allClassesNextDo(&state);
+	}
+	vmFuncs->allClassesEndDo(&state);
+}
+
 #if JAVA_SPEC_VERSION >= 11
 /**
  * \brief  Fix any resolved nest members
@@ -2465,6 +2493,8 @@ swapClassesForFastHCR(J9Class *originalClass, J9Class *obsoleteClass)
 	SWAP_MEMBER(jniIDs, void **, originalClass, obsoleteClass);
 	SWAP_MEMBER(romClass, J9ROMClass *, originalClass, obsoleteClass);
 	SWAP_MEMBER(ramMethods, J9Method *, originalClass, obsoleteClass);
+	/* The method lookup index is built from the ROM methods, so it follows them */
+	SWAP_MEMBER(methodLookupIndex, J9MethodLookupIndex *, originalClass, obsoleteClass);
 	SWAP_MEMBER(ramConstantPool, J9ConstantPool *, originalClass, obsoleteClass);
 	((J9ConstantPool *) originalClass->ramConstantPool)->ramClass = originalClass;
 	((J9ConstantPool *) obsoleteClass->ramConstantPool)->ramClass = obsoleteClass;
@@ -40,6 +40,7 @@
 #include "jlm.h"
 #include "util_internal.h"
 #include "jvmtiInternal.h"
+#include "monhelp.h"
 
 
 /*
@@ -113,6 +114,8 @@
 /* Dump Format defs */
 /* 1 byte raw/Java + 1 held + 4 enter + 4 slow + 4 recursive + 4 spin2 + 4 yield + 8 hold time = 30  */
 #define JLM_DUMP_COUNT_FIELD_SIZE 30
+/* 4 spin acquire + 4 spin fail + 4 spin budget = 12, only in COM_IBM_JLM_DUMP_FORMAT_SPIN_STATS */
+#define JLM_DUMP_SPIN_STATS_FIELD_SIZE 12
 /* 2 integer fields */ 
 #define JLM_DUMP_FORMAT_SIZE       8
 /* version */
@@ -120,6 +123,7 @@
 
 
 static void GetMonitorName (J9VMThread *vmThread, J9ThreadAbstractMonitor *monitor, char *nameBuf);
+static J9ObjectMonitor *peekObjectMonitor(J9VMThread *vmThread, j9object_t object);
 
 
 jint 
@@ -180,7 +184,7 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 
 			/* If format with tags is required, write the tag (8 bytes),
 			   otherwise write 0 in the objectid field - 4 or 8 bytes */
-			if (dump_format == COM_IBM_JLM_DUMP_FORMAT_TAGS) {
+			if (dump_format != COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) {
 				jlong tag = 0;
 					if (monitor->flags & J9THREAD_MONITOR_OBJECT) {
 					j9object_t object = J9WEAKROOT_OBJECT_LOAD(vmThread, &monitor->userData);
@@ -215,6 +219,26 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 				}
 			}
 
+			/* The spin statistics are kept in the J9ObjectMonitor, raw monitors have none */
+			if (dump_format == COM_IBM_JLM_DUMP_FORMAT_SPIN_STATS) {
+				J9ObjectMonitor *objectMonitor = NULL;
+				if (monitor->flags & J9THREAD_MONITOR_OBJECT) {
+					j9object_t object = J9WEAKROOT_OBJECT_LOAD(vmThread, &monitor->userData);
+					if (NULL != object) {
+						objectMonitor = peekObjectMonitor(vmThread, object);
+					}
+				}
+				if (NULL != objectMonitor) {
+					WRITE_4BYTES(objectMonitor->spinAcquireCount);
+					WRITE_4BYTES(objectMonitor->spinFailCount);
+					WRITE_4BYTES(objectMonitor->spinBudget);
+				} else {
+					WRITE_4BYTES(0);
+					WRITE_4BYTES(0);
+					WRITE_4BYTES(0);
+				}
+			}
+
 			GetMonitorName(vmThread, monitor, monitor_name);
 			strcpy(dump, monitor_name);
 
@@ -240,7 +264,7 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 		WRITE_8BYTES(0);
 #endif /* defined(OMR_THR_JLM_HOLD_TIMES) */
 
-		if (dump_format == COM_IBM_JLM_DUMP_FORMAT_TAGS) {
+		if (dump_format != COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) {
 			WRITE_8BYTES(0);
 		} else {
 			/* The next field has a pointer size */
@@ -251,6 +275,12 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 			}
 		}
 
+		if (dump_format == COM_IBM_JLM_DUMP_FORMAT_SPIN_STATS) {
+			WRITE_4BYTES(0);
+			WRITE_4BYTES(0);
+			WRITE_4BYTES(0);
+		}
+
 		strcpy(dump, lnrl_lock->monitor_name);
 		dump += strlen(lnrl_lock->monitor_name) + 1;
 	}
@@ -384,6 +414,26 @@ GetMonitorName(J9VMThread *vmThread, J9ThreadAbstractMonitor *monitor, char *nam
 }
 
 
+/**
+ * Find the J9ObjectMonitor of an object without creating one. The dump runs with exclusive VM access
+ * and the thread library lock held, so it must not initialize a monitor as monitorTableAt() may.
+ * @param[in] vmThread the current thread
+ * @param[in] object the object
+ * @return the J9ObjectMonitor, or NULL if the object has none
+ */
+static J9ObjectMonitor *
+peekObjectMonitor(J9VMThread *vmThread, j9object_t object)
+{
+	if (LN_HAS_LOCKWORD(vmThread, object)) {
+		j9objectmonitor_t lockWord = J9_LOAD_LOCKWORD(vmThread, J9OBJECT_MONITOR_EA(vmThread, object));
+		if (J9_LOCK_IS_INFLATED(lockWord)) {
+			return J9_INFLLOCK_OBJECT_MONITOR(lockWord);
+		}
+	}
+	return monitorTablePeek(vmThread->javaVM, object);
+}
+
+
 jint request_MonitorJlmDumpSize(J9JavaVM * jvm, UDATA * dump_size, jint dump_format)
 {
 #if	defined(OMR_THR_JLM)
@@ -394,6 +444,7 @@ jint request_MonitorJlmDumpSize(J9JavaVM * jvm, UDATA * dump_size, jint dump_for
 	char monitor_name[OBJ_MON_NAME_BUF_SIZE];
 	jint rc = (jint) JLM_SUCCESS;
 	int objIDfieldSize;
+	int spinStatsFieldSize = 0;
 	J9MemoryManagerFunctions * memoryManagerFunctions = jvm->memoryManagerFunctions;
 	J9ThreadMonitorTracing *lnrl_lock = NULL;
 	pool_state j9gc_LWNRLock_walk_state = { 0 };
@@ -410,6 +461,9 @@ jint request_MonitorJlmDumpSize(J9JavaVM * jvm, UDATA * dump_size, jint dump_for
 	if (dump_format != COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) {
 		*dump_size    = JLM_DUMP_FORMAT_SIZE;
 		objIDfieldSize = 8;
+		if (dump_format == COM_IBM_JLM_DUMP_FORMAT_SPIN_STATS) {
+			spinStatsFieldSize = JLM_DUMP_SPIN_STATS_FIELD_SIZE;
+		}
 	} else {
 		*dump_size = 0;
 		objIDfieldSize = sizeof(void *);
@@ -421,7 +475,7 @@ jint request_MonitorJlmDumpSize(J9JavaVM * jvm, UDATA * dump_size, jint dump_for
 	while ( NULL != (monitor = (J9ThreadAbstractMonitor *) omrthread_monitor_walk_no_locking(&walkState)) ) {
 		if (monitor->tracing) {
 				GetMonitorName(vmThread, monitor, monitor_name);
-				*dump_size += JLM_DUMP_COUNT_FIELD_SIZE + objIDfieldSize + strlen(monitor_name)+1;
+				*dump_size += JLM_DUMP_COUNT_FIELD_SIZE + objIDfieldSize + spinStatsFieldSize + strlen(monitor_name)+1;
 		}
 	}
 
@@ -430,7 +484,7 @@ jint request_MonitorJlmDumpSize(J9JavaVM * jvm, UDATA * dump_size, jint dump_for
 	 * @note omrgc_walkLWNRLockTracePool locks the pool and unlocks it after iterating all elements.
 	 */
 	while (NULL != (lnrl_lock = memoryManagerFunctions->omrgc_walkLWNRLockTracePool(jvm->omrVM, &j9gc_LWNRLock_walk_state))) {
-		*dump_size += JLM_DUMP_COUNT_FIELD_SIZE + objIDfieldSize + strlen(lnrl_lock->monitor_name) + 1;
+		*dump_size += JLM_DUMP_COUNT_FIELD_SIZE + objIDfieldSize + spinStatsFieldSize + strlen(lnrl_lock->monitor_name) + 1;
 	}
 
 	return rc;
@@ -3039,6 +3039,8 @@ done:
 				/* No need for VMStructHasBeenUpdated as the above walk cannot change the roots */
 				UDATA framesWalked = walkState->framesWalked;
 				UDATA *cachePointer = walkState->cache;
+				UDATA shapeHash = 0;
+				bool deduplicate = false;
 				if (J9_STACKWALK_RC_NONE != walkRC) {
 					/* Avoid infinite recursion if already throwing OOM */
 					if (_currentThread->privateFlags & J9_PRIVATE_FLAGS_OUT_OF_MEMORY) {
@@ -3059,6 +3061,18 @@ done:
 #else
 					J9Class *arrayClass = _vm->intArrayClass;
 #endif
+					/* Exceptions filled in for the first time may share the walkback of an identical
+					 * stack trace. Walkbacks that are refilled, such as the one preallocated for
+					 * OutOfMemoryError, are overwritten in place and so are never shared.
+					 */
+					if ((NULL == walkback) && J9_ARE_ANY_BITS_SET(_vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_DEDUPLICATE_STACK_TRACES)) {
+						walkback = findDeduplicatedStackTrace(_currentThread, cachePointer, framesWalked, &shapeHash);
+						if (NULL != walkback) {
+							freeStackWalkCaches(_currentThread, walkState);
+							goto recursiveOOM;
+						}
+						deduplicate = true;
+					}
 					walkback = allocateIndexableObject(REGISTER_ARGS, arrayClass, (U_32)framesWalked, false);
 					if (J9_UNEXPECTED(NULL == walkback)) {
 						rc = THROW_HEAP_OOM;
@@ -3078,6 +3092,9 @@ done:
 					_objectAccessBarrier.inlineIndexableObjectStoreI32(_currentThread, walkback, i, cachePointer[i]);
 #endif
 				}
+				if (deduplicate) {
+					cacheDeduplicatedStackTrace(_currentThread, walkback, shapeHash);
+				}
 				freeStackWalkCaches(_currentThread, walkState);
 recursiveOOM:
 				restoreInternalNativeStackFrame(REGISTER_ARGS);
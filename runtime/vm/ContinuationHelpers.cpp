@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+#include "j9protos.h"
+#include "j9consts.h"
+#include "stackwalk.h"
+#include "ut_j9vm.h"
+#include "vm_internal.h"
+#include "omrlinkedlist.h"
+
+#include "ContinuationHelpers.hpp"
+
+extern "C" {
+
+static void releaseContinuation(J9JavaVM *vm, J9VMContinuation *continuation);
+
+J9VMContinuation *
+createContinuation(J9VMThread *currentThread, UDATA stackSize)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9VMContinuation *continuation = NULL;
+
+	Assert_VM_mustHaveVMAccess(currentThread);
+
+	if (0 == stackSize) {
+#if defined(J9VM_INTERP_GROWABLE_STACKS)
+		stackSize = (vm->initialStackSize > (UDATA)vm->stackSize) ? vm->stackSize : vm->initialStackSize;
+#else /* J9VM_INTERP_GROWABLE_STACKS */
+		stackSize = vm->stackSize;
+#endif /* J9VM_INTERP_GROWABLE_STACKS */
+	}
+	continuation = (J9VMContinuation *)j9mem_allocate_memory(sizeof(J9VMContinuation), OMRMEM_CATEGORY_THREADS);
+	if (NULL != continuation) {
+		J9JavaStack *stack = allocateJavaStack(vm, stackSize, NULL);
+
+		memset(continuation, 0, sizeof(J9VMContinuation));
+		if (NULL == stack) {
+			j9mem_free_memory(continuation);
+			continuation = NULL;
+		} else {
+			/* Build the initial call-out frame, as initializeExecutionModel does for a new thread */
+			J9SFJNINativeMethodFrame *frame = ((J9SFJNINativeMethodFrame*)stack->end) - 1;
+			frame->method = NULL;
+			frame->specialFrameFlags = 0;
+			frame->savedCP = NULL;
+			frame->savedPC = (U_8*)(UDATA)J9SF_FRAME_TYPE_END_OF_STACK;
+			frame->savedA0 = (UDATA*)(UDATA)J9SF_A0_INVISIBLE_TAG;
+			continuation->sp = (UDATA*)frame;
+			continuation->literals = (J9Method*)0;
+			continuation->pc = (U_8*)J9SF_FRAME_TYPE_JNI_NATIVE_METHOD;
+			continuation->arg0EA = (UDATA*)&frame->savedA0;
+			continuation->stackObject = stack;
+			continuation->stackOverflowMark = continuation->stackOverflowMark2 = J9JAVASTACK_STACKOVERFLOWMARK(stack);
+
+			omrthread_monitor_enter(vm->vmThreadListMutex);
+			J9_LINKED_LIST_ADD_LAST(vm->continuationList, continuation);
+			omrthread_monitor_exit(vm->vmThreadListMutex);
+		}
+	}
+
+	Trc_VM_createContinuation(currentThread, continuation, stackSize);
+	return continuation;
+}
+
+void
+freeContinuation(J9VMThread *currentThread, J9VMContinuation *continuation)
+{
+	Assert_VM_mustHaveVMAccess(currentThread);
+	Assert_VM_true(NULL == continuation->carrierThread);
+
+	Trc_VM_freeContinuation(currentThread, continuation);
+	releaseContinuation(currentThread->javaVM, continuation);
+}
+
+void
+freeAllContinuations(J9JavaVM *vm)
+{
+	/* No Java threads are left, so none of the continuations is mounted */
+	while (NULL != vm->continuationList) {
+		releaseContinuation(vm, vm->continuationList);
+	}
+}
+
+/**
+ * Remove a continuation from vm->continuationList and free it and its stacks.
+ *
+ * @param vm[in] the J9JavaVM
+ * @param continuation[in] the continuation
+ */
+static void
+releaseContinuation(J9JavaVM *vm, J9VMContinuation *continuation)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9JavaStack *currentStack = continuation->stackObject;
+
+	omrthread_monitor_enter(vm->vmThreadListMutex);
+	J9_LINKED_LIST_REMOVE(vm->continuationList, continuation);
+	omrthread_monitor_exit(vm->vmThreadListMutex);
+
+	/* Free all the stacks used by the continuation, as deallocateVMThread does */
+	while (NULL != currentStack) {
+		J9JavaStack *previous = currentStack->previous;
+
+		freeJavaStack(vm, currentStack);
+		currentStack = previous;
+	}
+	j9mem_free_memory(continuation);
+}
+
+BOOLEAN
+mountContinuation(J9VMThread *currentThread, J9VMContinuation *continuation)
+{
+	BOOLEAN result = FALSE;
+
+	Assert_VM_mustHaveVMAccess(currentThread);
+
+	/* Continuations do not nest, and a continuation runs on one carrier at a time */
+	if ((NULL == currentThread->currentContinuation) && (NULL == continuation->carrierThread)) {
+		VM_ContinuationHelpers::swapFieldsWithContinuation(currentThread, continuation);
+		continuation->carrierThread = currentThread;
+		currentThread->currentContinuation = continuation;
+		result = TRUE;
+	}
+
+	Trc_VM_mountContinuation(currentThread, continuation, result);
+	return result;
+}
+
+J9VMContinuation *
+unmountContinuation(J9VMThread *currentThread)
+{
+	J9VMContinuation *continuation = currentThread->currentContinuation;
+
+	Assert_VM_mustHaveVMAccess(currentThread);
+
+	if (NULL != continuation) {
+		/* A continuation cannot be unmounted while it holds monitors or JNI reference frames */
+		Assert_VM_true(NULL == currentThread->monitorEnterRecords);
+		Assert_VM_true(NULL == currentThread->jniMonitorEnterRecords);
+		Assert_VM_true(NULL == currentThread->jniLocalReferences);
+		VM_ContinuationHelpers::swapFieldsWithContinuation(currentThread, continuation);
+		continuation->carrierThread = NULL;
+		currentThread->currentContinuation = NULL;
+	}
+
+	Trc_VM_unmountContinuation(currentThread, continuation);
+	return continuation;
+}
+
+UDATA
+walkContinuationStackFrames(J9VMThread *currentThread, J9VMContinuation *continuation, J9StackWalkState *walkState)
+{
+	J9VMThread stackThread;
+	J9VMEntryLocalStorage els;
+
+	memset(&stackThread, 0, sizeof(stackThread));
+	memset(&els, 0, sizeof(els));
+	VM_ContinuationHelpers::copyFieldsFromContinuation(currentThread, &stackThread, &els, continuation);
+	walkState->walkThread = &stackThread;
+	return currentThread->javaVM->walkStackFrames(currentThread, walkState);
+}
+
+} /* extern "C" */
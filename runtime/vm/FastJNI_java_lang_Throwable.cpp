@@ -69,6 +69,8 @@ Fast_java_lang_Throwable_fillInStackTrace(J9VMThread *currentThread, j9object_t
 			UDATA walkRC = vm->walkStackFrames(currentThread, walkState);
 			UDATA framesWalked = walkState->framesWalked;
 			UDATA *cachePointer = walkState->cache;
+			UDATA shapeHash = 0;
+			bool deduplicate = false;
 			if (J9_STACKWALK_RC_NONE != walkRC) {
 				/* Avoid infinite recursion if already throwing OOM */
 				if (currentThread->privateFlags & J9_PRIVATE_FLAGS_OUT_OF_MEMORY) {
@@ -86,6 +88,18 @@ Fast_java_lang_Throwable_fillInStackTrace(J9VMThread *currentThread, j9object_t
 #else
 				J9Class *arrayClass = vm->intArrayClass;
 #endif
+				/* Exceptions filled in for the first time may share the walkback of an identical
+				 * stack trace. Walkbacks that are refilled, such as the one preallocated for
+				 * OutOfMemoryError, are overwritten in place and so are never shared.
+				 */
+				if ((NULL == walkback) && J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_DEDUPLICATE_STACK_TRACES)) {
+					walkback = findDeduplicatedStackTrace(currentThread, cachePointer, framesWalked, &shapeHash);
+					if (NULL != walkback) {
+						freeStackWalkCaches(currentThread, walkState);
+						goto recursiveOOM;
+					}
+					deduplicate = true;
+				}
 				walkback = objectAllocate.inlineAllocateIndexableObject(currentThread, arrayClass, (U_32)framesWalked, false);
 				if (NULL == walkback) {
 					PUSH_OBJECT_IN_SPECIAL_FRAME(currentThread, receiver);
@@ -110,6 +124,9 @@ Fast_java_lang_Throwable_fillInStackTrace(J9VMThread *currentThread, j9object_t
 				objectAccessBarrier.inlineIndexableObjectStoreI32(currentThread, walkback, i, cachePointer[i]);
 #endif
 			}
+			if (deduplicate) {
+				cacheDeduplicatedStackTrace(currentThread, walkback, shapeHash);
+			}
 			freeStackWalkCaches(currentThread, walkState);
 recursiveOOM:
 			J9VMJAVALANGTHROWABLE_SET_WALKBACK(currentThread, receiver, walkback);
@@ -28,6 +28,11 @@
 #if defined(J9UNIX) || defined(AIXPPC)
 #include <sys/mman.h>
 #endif /* J9UNIX || AIXPPC */
+#if defined(LINUX)
+#include <errno.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* LINUX */
 #include "ut_j9vm.h"
 #include "AtomicSupport.hpp"
 
@@ -35,6 +40,34 @@ extern "C" {
 
 #if defined(J9VM_INTERP_ATOMIC_FREE_JNI_USES_FLUSH)
 
+#if defined(LINUX) && defined(__NR_membarrier)
+/* Commands from linux/membarrier.h, which may be missing from older build environments */
+#define J9_MEMBARRIER_CMD_QUERY 0
+#define J9_MEMBARRIER_CMD_PRIVATE_EXPEDITED (1 << 3)
+#define J9_MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED (1 << 4)
+
+/**
+ * Register the process for expedited private membarrier commands, available since Linux 4.14.
+ * A private expedited membarrier only interrupts the CPUs currently running threads of this
+ * process, and does not need the guard page or the flushMutex.
+ *
+ * @return TRUE if flushProcessWriteBuffers can use membarrier, FALSE otherwise
+ */
+static UDATA
+registerMembarrier(void)
+{
+	UDATA rc = FALSE;
+	long commands = syscall(__NR_membarrier, J9_MEMBARRIER_CMD_QUERY, 0);
+	if ((commands > 0)
+		&& J9_ARE_ALL_BITS_SET(commands, J9_MEMBARRIER_CMD_PRIVATE_EXPEDITED | J9_MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED)
+		&& (0 == syscall(__NR_membarrier, J9_MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0))
+	) {
+		rc = TRUE;
+	}
+	return rc;
+}
+#endif /* LINUX && __NR_membarrier */
+
 void
 flushProcessWriteBuffers(J9JavaVM *vm)
 {
@@ -46,6 +79,16 @@ flushProcessWriteBuffers(J9JavaVM *vm)
 		((VOID (WINAPI*)(void))vm->flushFunction)();
 	}
 #elif defined(J9UNIX) || defined(AIXPPC) /* WIN32 */
+#if defined(LINUX) && defined(__NR_membarrier)
+	if (vm->flushUsesMembarrier) {
+		if (0 == syscall(__NR_membarrier, J9_MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0)) {
+			return;
+		}
+		/* Fall back to the guard page should the command ever fail */
+		Trc_VM_flushProcessWriteBuffers_membarrierFailed(errno);
+		vm->flushUsesMembarrier = FALSE;
+	}
+#endif /* LINUX && __NR_membarrier */
 	if (NULL != vm->flushMutex) {
 		omrthread_monitor_enter(vm->flushMutex);
 		void *addr = vm->exclusiveGuardPage.address;
@@ -91,6 +134,16 @@ initializeExclusiveAccess(J9JavaVM *vm)
 		shutDownExclusiveAccess(vm);
 		rc = 1;
 	}
+#if defined(LINUX)
+	/* The guard page remains initialized as the fallback */
+	vm->flushUsesMembarrier = FALSE;
+#if defined(__NR_membarrier)
+	if ((0 == rc) && vm->thrMembarrier) {
+		vm->flushUsesMembarrier = registerMembarrier();
+	}
+#endif /* __NR_membarrier */
+	Trc_VM_initializeExclusiveAccess_membarrier(vm->flushUsesMembarrier);
+#endif /* LINUX */
 #elif defined(WIN32) /* LINUX || AIXPPC */
 	HMODULE h_kernel32 = GetModuleHandle("kernel32");
 	Assert_VM_notNull(h_kernel32);
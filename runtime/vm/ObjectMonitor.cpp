@@ -46,6 +46,9 @@ extern "C" {
 
 #define J9VM_SAMPLE_TIMESTAMP_FREQUENCY 1024
 
+/* Number of object monitors created for the instances of a class above which the class is considered contended */
+#define J9_LOCK_PROFILE_CONTENDED_THRESHOLD 64
+
 static bool
 spinOnFlatLock(J9VMThread *currentThread, j9objectmonitor_t volatile *lwEA, j9object_t object);
 
@@ -625,6 +628,7 @@ spinOnTryEnter(J9VMThread *currentThread, J9ObjectMonitor *objectMonitor, j9obje
 
 	bool nestedPath = true;
 	bool rc = false;
+	bool spinAcquired = false;
 	IDATA rc_tryEnterUsingThreadID = 0;
 
 	UDATA tryEnterSpinCount2 = vm->thrMaxTryEnterSpins2BeforeBlocking;
@@ -674,6 +678,24 @@ spinOnTryEnter(J9VMThread *currentThread, J9ObjectMonitor *objectMonitor, j9obje
 	}
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_SPIN_WAKE_CONTROL) */
 
+	/* Limit the spinning to the budget this monitor has earned from its recent history, so that
+	 * monitors which are rarely acquired by spinning quickly fall back to blocking.
+	 */
+	bool const adaptSpin = (0 != vm->thrAdaptiveObjectMonitorSpin) && (tryEnterYieldCount > 1);
+	UDATA const maxTryEnterYieldCount = tryEnterYieldCount;
+	if (adaptSpin) {
+		UDATA const spinBudget = objectMonitor->spinBudget;
+		if (spinBudget < tryEnterYieldCount) {
+			if (0 == spinBudget) {
+				/* Probe once so that a change in the monitor's behaviour is still noticed */
+				tryEnterSpinCount2 = 1;
+				tryEnterYieldCount = 1;
+			} else {
+				tryEnterYieldCount = spinBudget;
+			}
+		}
+	}
+
 	/* Need to store the original value of tryEnterSpinCount2 since it gets overridden during non-nested spinning */
 	UDATA tryEnterSpinCount2Init = tryEnterSpinCount2;
 
@@ -687,6 +709,7 @@ spinOnTryEnter(J9VMThread *currentThread, J9ObjectMonitor *objectMonitor, j9obje
 		for (_tryEnterSpinCount2 = tryEnterSpinCount2; _tryEnterSpinCount2 > 0; _tryEnterSpinCount2--) {
 			rc_tryEnterUsingThreadID = omrthread_monitor_try_enter_using_threadId(monitor, osThread);
 			if (0 == rc_tryEnterUsingThreadID) {
+				spinAcquired = true;
 #if defined(J9VM_THR_SMART_DEFLATION)
 				/* Update the monitor's pro deflation vote because we got in without blocking */
 				if (VM_AtomicSupport::sampleTimestamp(J9VM_SAMPLE_TIMESTAMP_FREQUENCY)) {
@@ -766,6 +789,22 @@ update_jlm:
 	}
 #endif /* OMR_THR_JLM */
 
+	/* Update the spin history of the monitor. The updates are racy, which is acceptable
+	 * since the budget is only a heuristic. Spinning that pays off grows the budget by
+	 * one yield round, spinning that runs out halves it.
+	 */
+	if (spinAcquired) {
+		objectMonitor->spinAcquireCount += 1;
+		if (adaptSpin && (objectMonitor->spinBudget < maxTryEnterYieldCount)) {
+			objectMonitor->spinBudget += 1;
+		}
+	} else if (0 == _tryEnterYieldCount) {
+		objectMonitor->spinFailCount += 1;
+		if (adaptSpin) {
+			objectMonitor->spinBudget /= 2;
+		}
+	}
+
 #if defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_SPIN_WAKE_CONTROL)
 	if (tryEnterSpin && (OMRTHREAD_IGNORE_SPIN_THREAD_BOUND != lib->maxSpinThreads)) {
 		VM_AtomicSupport::subtract(&monitor->spinThreads, 1);
@@ -775,4 +814,56 @@ update_jlm:
 	return rc;
 }
 
+BOOLEAN
+getLockClassProfile(J9JavaVM *vm, J9Class *clazz, J9SharedClassProfile *profile)
+{
+	U_8 lockProfile = J9_CLASS_PROFILE_LOCK_STATE_LEARNING;
+
+	if (vm->enableGlobalLockReservation) {
+		j9objectmonitor_t initialLockword = VM_ObjectMonitor::getInitialLockword(vm, clazz);
+		if (OBJECT_HEADER_LOCK_RESERVED == initialLockword) {
+			lockProfile = J9_CLASS_PROFILE_LOCK_STATE_RESERVED;
+		} else if (0 == initialLockword) {
+			lockProfile = J9_CLASS_PROFILE_LOCK_STATE_FLAT;
+		}
+#if defined(J9VM_ENV_DATA64)
+		if (clazz->monitorTableCounter >= J9_LOCK_PROFILE_CONTENDED_THRESHOLD) {
+			lockProfile |= J9_CLASS_PROFILE_LOCK_CONTENDED;
+		}
+#endif /* defined(J9VM_ENV_DATA64) */
+		profile->lockProfile = lockProfile;
+	}
+
+	return J9_CLASS_PROFILE_LOCK_STATE_LEARNING != lockProfile;
+}
+
+void
+seedLockFromClassProfile(J9VMThread *currentThread, J9Class *clazz, const J9SharedClassProfile *profile)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	U_8 lockProfile = profile->lockProfile;
+	U_8 lockState = lockProfile & J9_CLASS_PROFILE_LOCK_STATE_MASK;
+	bool contended = J9_ARE_ANY_BITS_SET(lockProfile, J9_CLASS_PROFILE_LOCK_CONTENDED);
+
+	if (vm->enableGlobalLockReservation && (J9_CLASS_PROFILE_LOCK_STATE_LEARNING != lockProfile)) {
+		/* Pick counter values for which getInitialLockword() selects the learned state */
+		if (contended || (J9_CLASS_PROFILE_LOCK_STATE_FLAT == lockState)) {
+			clazz->reservedCounter = 0;
+			clazz->cancelCounter = (U_16)OMR_MIN(vm->cancelAbsoluteThreshold, (U_16)0xFFFF);
+		} else if (J9_CLASS_PROFILE_LOCK_STATE_RESERVED == lockState) {
+			clazz->reservedCounter = (U_16)OMR_MIN(OMR_MAX(vm->reservedAbsoluteThreshold, 1), (U_16)0xFFFF);
+			clazz->cancelCounter = 0;
+		}
+		Trc_VM_seedLockFromClassProfile_seeded(currentThread, clazz, clazz->reservedCounter, clazz->cancelCounter);
+
+		/* The instance layout of a class must not change between runs sharing AOT code, so a
+		 * missing lockword is only reported, see -Xlockword:lockword=<class>.
+		 */
+		if (contended && ((UDATA)-1 == clazz->lockOffset)) {
+			J9UTF8 *className = J9ROMCLASS_CLASSNAME(clazz->romClass);
+			Trc_VM_seedLockFromClassProfile_lockwordCandidate(currentThread, clazz, J9UTF8_LENGTH(className), J9UTF8_DATA(className));
+		}
+	}
+}
+
 } /* extern "C" */
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9protos.h"
+#include "j9consts.h"
+#include "ut_j9vm.h"
+#include "vm_internal.h"
+#include "SCQueryFunctions.h"
+
+extern "C" {
+
+typedef struct J9SharedClassProfileCandidate {
+	J9ROMClass *romClass;
+	J9SharedClassProfile profile;
+	BOOLEAN hotFieldsSelected;
+	BOOLEAN lockLearned;
+} J9SharedClassProfileCandidate;
+
+/**
+ * @return true if the profile of the class can be kept in the shared class cache
+ */
+static bool
+isSharedProfileClass(J9JavaVM *vm, J9Class *clazz)
+{
+	J9ROMClass *romClass = clazz->romClass;
+
+	return J9_ARE_NO_BITS_SET(clazz->classLoader->flags, J9CLASSLOADER_ANON_CLASS_LOADER)
+		&& !J9ROMCLASS_IS_ARRAY(romClass)
+		&& j9shr_Query_IsAddressInCache(vm, romClass, romClass->romSize);
+}
+
+static void
+initDataDescriptor(J9SharedDataDescriptor *descriptor, J9SharedClassProfile *profile)
+{
+	descriptor->address = (U_8 *)profile;
+	descriptor->length = sizeof(J9SharedClassProfile);
+	descriptor->type = J9SHR_ATTACHED_DATA_TYPE_CLASSPROFILE;
+	descriptor->flags = J9SHR_ATTACHED_DATA_NO_FLAGS;
+}
+
+void
+loadClassProfileFromSharedCache(J9VMThread *currentThread, J9Class *clazz)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9SharedClassConfig *sharedClassConfig = vm->sharedClassConfig;
+
+	if ((NULL != sharedClassConfig) && isSharedProfileClass(vm, clazz)) {
+		J9SharedClassProfile profile;
+		J9SharedDataDescriptor descriptor;
+		IDATA corruptOffset = -1;
+
+		initDataDescriptor(&descriptor, &profile);
+		const U_8 *found = sharedClassConfig->findAttachedData(currentThread, clazz->romClass, &descriptor, &corruptOffset);
+		if ((J9SHR_RESOURCE_MAX_ERROR_VALUE < (UDATA)found)
+			&& (-1 == corruptOffset)
+			&& (sizeof(J9SharedClassProfile) == descriptor.length)
+		) {
+			seedHotFieldsFromClassProfile(currentThread, clazz, &profile);
+			seedLockFromClassProfile(currentThread, clazz, &profile);
+		}
+	}
+}
+
+void
+storeClassProfilesToSharedCache(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9SharedClassConfig *sharedClassConfig = vm->sharedClassConfig;
+	UDATA stored = 0;
+
+	if (NULL != sharedClassConfig) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		J9ClassWalkState walkState;
+		J9Pool *candidates = pool_new(sizeof(J9SharedClassProfileCandidate), 0, 0, 0, J9_GET_CALLSITE(), J9MEM_CATEGORY_CLASSES, POOL_FOR_PORT(PORTLIB));
+
+		if (NULL == candidates) {
+			return;
+		}
+
+		/* Collect the candidates under the class table mutex, but store them after releasing it */
+		J9Class *clazz = allLiveClassesStartDo(&walkState, vm, NULL);
+		while (NULL != clazz) {
+			if (isSharedProfileClass(vm, clazz)) {
+				J9SharedClassProfile profile;
+
+				memset(&profile, 0, sizeof(profile));
+				profile.totalInstanceSize = (U_32)clazz->totalInstanceSize;
+				profile.hotFieldOffset1 = U_8_MAX;
+				profile.hotFieldOffset2 = U_8_MAX;
+				profile.hotFieldOffset3 = U_8_MAX;
+				BOOLEAN hotFieldsSelected = getHotFieldsClassProfile(vm, clazz, &profile);
+				BOOLEAN lockLearned = getLockClassProfile(vm, clazz, &profile);
+				if (hotFieldsSelected || lockLearned) {
+					J9SharedClassProfileCandidate *candidate = (J9SharedClassProfileCandidate *)pool_newElement(candidates);
+					if (NULL == candidate) {
+						break;
+					}
+					/* The ROM class lives in the shared cache, so it remains valid once the walk is done */
+					candidate->romClass = clazz->romClass;
+					candidate->profile = profile;
+					candidate->hotFieldsSelected = hotFieldsSelected;
+					candidate->lockLearned = lockLearned;
+				}
+			}
+			clazz = allLiveClassesNextDo(&walkState);
+		}
+		allLiveClassesEndDo(&walkState);
+
+		pool_state poolState;
+		J9SharedClassProfileCandidate *candidate = (J9SharedClassProfileCandidate *)pool_startDo(candidates, &poolState);
+		while (NULL != candidate) {
+			J9SharedClassProfile existing;
+			J9SharedDataDescriptor existingDescriptor;
+			J9SharedDataDescriptor descriptor;
+			IDATA corruptOffset = -1;
+			UDATA rc = J9SHR_RESOURCE_STORE_EXISTS;
+
+			initDataDescriptor(&existingDescriptor, &existing);
+			initDataDescriptor(&descriptor, &candidate->profile);
+			const U_8 *found = sharedClassConfig->findAttachedData(currentThread, candidate->romClass, &existingDescriptor, &corruptOffset);
+			if (NULL == found) {
+				if (-1 == corruptOffset) {
+					rc = sharedClassConfig->storeAttachedData(currentThread, candidate->romClass, &descriptor, FALSE);
+				} else {
+					rc = sharedClassConfig->updateAttachedData(currentThread, candidate->romClass, 0, &descriptor);
+				}
+			} else if (J9SHR_RESOURCE_MAX_ERROR_VALUE < (UDATA)found) {
+				if (sizeof(J9SharedClassProfile) != existingDescriptor.length) {
+					rc = sharedClassConfig->storeAttachedData(currentThread, candidate->romClass, &descriptor, TRUE);
+				} else {
+					/* Keep what a previous run learned about the class but this run did not */
+					if (!candidate->hotFieldsSelected && (existing.totalInstanceSize == candidate->profile.totalInstanceSize)) {
+						candidate->profile.hotFieldOffset1 = existing.hotFieldOffset1;
+						candidate->profile.hotFieldOffset2 = existing.hotFieldOffset2;
+						candidate->profile.hotFieldOffset3 = existing.hotFieldOffset3;
+					}
+					if (!candidate->lockLearned) {
+						candidate->profile.lockProfile = existing.lockProfile;
+					}
+					if (0 != memcmp(&existing, &candidate->profile, sizeof(J9SharedClassProfile))) {
+						/* Rewrite the profile in place, so that the cache does not grow as the profile changes */
+						rc = sharedClassConfig->updateAttachedData(currentThread, candidate->romClass, 0, &descriptor);
+					}
+				}
+			} else if (J9SHR_RESOURCE_STORE_ERROR == (UDATA)found) {
+				/* A larger profile from another JVM level, replace it */
+				rc = sharedClassConfig->storeAttachedData(currentThread, candidate->romClass, &descriptor, TRUE);
+			}
+			if (0 == rc) {
+				stored += 1;
+			}
+			candidate = (J9SharedClassProfileCandidate *)pool_nextDo(&poolState);
+		}
+		pool_kill(candidates);
+	}
+
+	Trc_VM_storeClassProfilesToSharedCache_stored(currentThread, stored);
+}
+
+} /* extern "C" */
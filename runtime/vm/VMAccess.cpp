@@ -55,6 +55,7 @@ extern "C" {
 
 static void initializeExclusiveVMAccessStats(J9JavaVM* vm, J9VMThread* currentThread);
 static U_64 updateExclusiveVMAccessStats(J9VMThread* currentThread);
+static void reportExclusiveVMAccessResponders(J9JavaVM* vm, J9VMThread* currentThread);
 
 #if (defined(J9VM_DBG))
 static void badness (char *description);
@@ -96,10 +97,12 @@ initializeExclusiveVMAccessStats(J9JavaVM* vm, J9VMThread* currentThread)
 	vm->omrVM->exclusiveVMAccessStats.requester = (NULL == currentThread ? NULL : currentThread->omrVMThread);
 	vm->omrVM->exclusiveVMAccessStats.lastResponder = (NULL == currentThread ? NULL : currentThread->omrVMThread);
 	vm->omrVM->exclusiveVMAccessStats.haltedThreads = 0;
+	memset(&vm->exclusiveSlowestResponder, 0, sizeof(vm->exclusiveSlowestResponder));
 }
 
 /**
  * Update the vm's J9ExclusiveVMStats structure once currentThread has responded.
+ * Caller must hold vm->exclusiveAccessMutex.
  *
  * @parm[in] currentThread the thread responding
  *
@@ -110,7 +113,65 @@ updateExclusiveVMAccessStats(J9VMThread* currentThread)
 {
 	J9JavaVM* const vm = currentThread->javaVM;
 	PORT_ACCESS_FROM_JAVAVM(vm);
-	return VM_VMAccess::updateExclusiveVMAccessStats(currentThread, vm, PORTLIB);
+	U_64 timeNow = VM_VMAccess::updateExclusiveVMAccessStats(currentThread, vm, PORTLIB);
+
+	Trc_VM_updateExclusiveVMAccessStats_responded(currentThread,
+			j9time_hires_delta(vm->omrVM->exclusiveVMAccessStats.startTime, timeNow, J9PORT_TIME_DELTA_IN_MICROSECONDS),
+			currentThread->omrVMThread->vmState);
+	return timeNow;
+}
+
+/**
+ * Report the threads which were slow to respond to an exclusive access request, and clear the
+ * response time of all threads for the next request. The top frame of a slow responder identifies
+ * the code that delayed its response, but walking it is only worthwhile when it is traced.
+ * Called once all threads have responded and exclusiveAccessMutex has been released. The
+ * responders are halted or out of the VM, so their stacks can be walked from the requester.
+ * Caller must hold vm->vmThreadListMutex.
+ *
+ * @parm[in] vm the J9JavaVM
+ * @parm[in] currentThread the thread which requested exclusive access, or NULL if external
+ */
+static void
+reportExclusiveVMAccessResponders(J9JavaVM* vm, J9VMThread* currentThread)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9ExclusiveVMAccessResponder *slowestResponder = &vm->exclusiveSlowestResponder;
+	bool walkResponders = (0 != TrcEnabled_Trc_VM_acquireExclusiveVMAccess_slowResponder);
+	J9VMThread *walkThread = vm->mainThread;
+
+	Trc_VM_acquireExclusiveVMAccess_timeToSafePoint(currentThread,
+			j9time_hires_delta(vm->omrVM->exclusiveVMAccessStats.startTime, vm->omrVM->exclusiveVMAccessStats.endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
+			(UDATA)vm->omrVM->exclusiveVMAccessStats.haltedThreads);
+
+	if (NULL != walkThread) {
+		do {
+			if (walkResponders && (walkThread->exclusiveResponseTime >= J9VM_EXCLUSIVE_SLOW_RESPONSE_THRESHOLD)) {
+				J9StackWalkState walkState;
+				J9UTF8 *className = NULL;
+				J9UTF8 *methodName = NULL;
+
+				walkState.walkThread = walkThread;
+				walkState.flags = J9_STACKWALK_VISIBLE_ONLY | J9_STACKWALK_INCLUDE_NATIVES | J9_STACKWALK_COUNT_SPECIFIED;
+				walkState.maxFrames = 1;
+				walkState.skipCount = 0;
+				vm->walkStackFrames(currentThread, &walkState);
+				J9Method *method = walkState.method;
+				if (NULL != method) {
+					className = J9ROMCLASS_CLASSNAME(J9_CLASS_FROM_METHOD(method)->romClass);
+					methodName = J9ROMMETHOD_NAME(J9_ROM_METHOD_FROM_RAM_METHOD(method));
+				}
+				if (walkThread == slowestResponder->thread) {
+					slowestResponder->method = method;
+				}
+				Trc_VM_acquireExclusiveVMAccess_slowResponder(currentThread, walkThread,
+						walkThread->exclusiveResponseTime, walkThread->exclusiveResponseVMState,
+						(NULL == className) ? 0 : (U_32)J9UTF8_LENGTH(className), (NULL == className) ? "" : (const char *)J9UTF8_DATA(className),
+						(NULL == methodName) ? 0 : (U_32)J9UTF8_LENGTH(methodName), (NULL == methodName) ? "" : (const char *)J9UTF8_DATA(methodName));
+			}
+			walkThread->exclusiveResponseTime = 0;
+		} while ((walkThread = walkThread->linkNext) != vm->mainThread);
+	}
 }
 
 
@@ -324,6 +385,7 @@ acquireExclusiveVMAccess(J9VMThread * vmThread)
 		omrthread_monitor_enter(vm->vmThreadListMutex);
 
 		vm->omrVM->exclusiveVMAccessStats.endTime = j9time_hires_clock();
+		reportExclusiveVMAccessResponders(vm, vmThread);
 	}
 	Assert_VM_true(J9_XACCESS_EXCLUSIVE == vm->exclusiveAccessState);
 	Trc_VM_acquireExclusiveVMAccess_Exit(vmThread);
@@ -724,6 +786,7 @@ waitForResponseFromExternalThread(J9JavaVM * vm, UDATA vmResponsesExpected, UDAT
 	omrthread_monitor_enter(vm->vmThreadListMutex);
 
 	vm->omrVM->exclusiveVMAccessStats.endTime = j9time_hires_clock();
+	reportExclusiveVMAccessResponders(vm, NULL);
 }
 
 void
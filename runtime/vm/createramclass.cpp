@@ -2896,6 +2896,11 @@ fail:
 			ramClass->romClass = romClass;
 			ramClass->eyecatcher = 0x99669966;
 			ramClass->module = NULL;
+#if defined(J9VM_ENV_DATA64)
+			ramClass->monitorTableCounter = 0;
+#endif /* defined(J9VM_ENV_DATA64) */
+			ramClass->methodLookupIndex = NULL;
+			ramClass->methodLookupCache = NULL;
 			ramClass->reservedCounter = 0;
 			ramClass->cancelCounter = 0;
 
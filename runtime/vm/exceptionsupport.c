@@ -1252,6 +1252,90 @@ initializeHeapOOMMessage(J9VMThread *currentThread)
 }
 
 
+jint
+initializeStackTraceDedupCache(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	jint result = JNI_OK;
+
+	if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_DEDUPLICATE_STACK_TRACES)) {
+		J9Class *jlObject = J9VMJAVALANGOBJECT_OR_NULL(vm);
+		J9Class *arrayClass = jlObject->arrayClass;
+		j9object_t table = NULL;
+
+		result = JNI_ENOMEM;
+		if (NULL == arrayClass) {
+			J9ROMArrayClass *arrayOfObjectsROMClass = (J9ROMArrayClass *)J9ROMIMAGEHEADER_FIRSTCLASS(vm->arrayROMClasses);
+			arrayClass = internalCreateArrayClass(currentThread, arrayOfObjectsROMClass, jlObject);
+		}
+		if (NULL != arrayClass) {
+			/* The table is held strongly, so that the GC keeps the cached walkbacks consistent
+			 * through the usual barriers. Its size bounds the memory retained.
+			 */
+			table = vm->memoryManagerFunctions->J9AllocateIndexableObject(currentThread, arrayClass, J9VM_STACK_TRACE_DEDUP_CACHE_SIZE, J9_GC_ALLOCATE_OBJECT_TENURED | J9_GC_ALLOCATE_OBJECT_NON_INSTRUMENTABLE);
+		}
+		if (NULL != table) {
+			jobject globalRef = j9jni_createGlobalRef((JNIEnv*)currentThread, table, JNI_FALSE);
+
+			if (NULL != globalRef) {
+				vm->stackTraceDedupCacheRef = (j9object_t*)globalRef;
+				result = JNI_OK;
+			}
+		}
+	}
+	return result;
+}
+
+
+j9object_t
+findDeduplicatedStackTrace(J9VMThread *currentThread, UDATA *frames, UDATA frameCount, UDATA *shapeHash)
+{
+	j9object_t *tableRef = currentThread->javaVM->stackTraceDedupCacheRef;
+	j9object_t walkback = NULL;
+	UDATA hash = frameCount;
+	UDATA i = 0;
+
+	for (i = 0; i < frameCount; i++) {
+		hash = (hash * 31) + frames[i];
+	}
+	hash ^= hash >> 16;
+	*shapeHash = hash;
+
+	if (NULL != tableRef) {
+		walkback = J9JAVAARRAYOFOBJECT_LOAD(currentThread, *tableRef, hash & (J9VM_STACK_TRACE_DEDUP_CACHE_SIZE - 1));
+		if (NULL != walkback) {
+			if (J9INDEXABLEOBJECT_SIZE(currentThread, walkback) != frameCount) {
+				walkback = NULL;
+			} else {
+				for (i = 0; i < frameCount; i++) {
+					if (J9JAVAARRAYOFUDATA_LOAD(currentThread, walkback, i) != frames[i]) {
+						walkback = NULL;
+						break;
+					}
+				}
+			}
+		}
+	}
+	if (NULL != walkback) {
+		Trc_VM_findDeduplicatedStackTrace_hit(currentThread, walkback, frameCount);
+	}
+	return walkback;
+}
+
+
+void
+cacheDeduplicatedStackTrace(J9VMThread *currentThread, j9object_t walkback, UDATA shapeHash)
+{
+	j9object_t *tableRef = currentThread->javaVM->stackTraceDedupCacheRef;
+
+	if (NULL != tableRef) {
+		/* Publish the frames before the walkback becomes visible to other threads */
+		issueWriteBarrier();
+		J9JAVAARRAYOFOBJECT_STORE(currentThread, *tableRef, shapeHash & (J9VM_STACK_TRACE_DEDUP_CACHE_SIZE - 1), walkback);
+	}
+}
+
+
 void  
 setIllegalAccessErrorFinalFieldSet(J9VMThread *currentThread, UDATA isStatic, J9ROMClass *romClass, J9ROMFieldShape *field, J9ROMMethod *romMethod)
 {
@@ -309,6 +309,9 @@ J9InternalVMFunctions J9InternalFunctions = {
 	clearHaltFlag,
 	setHeapOutOfMemoryError,
 	initializeHeapOOMMessage,
+	initializeStackTraceDedupCache,
+	findDeduplicatedStackTrace,
+	cacheDeduplicatedStackTrace,
 	threadAboutToStart,
 	mustHaveVMAccess,
 #if defined(J9VM_PORT_ZOS_CEEHDLRSUPPORT)
@@ -406,4 +409,9 @@ J9InternalVMFunctions J9InternalFunctions = {
 	isCRIUSupportEnabled,
 	isCheckpointAllowed,
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
+	createContinuation,
+	freeContinuation,
+	mountContinuation,
+	unmountContinuation,
+	walkContinuationStackFrames,
 };
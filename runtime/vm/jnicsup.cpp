@@ -102,6 +102,7 @@ static jlong JNICALL getDirectBufferCapacity (JNIEnv *env, jobject buf);
 static void JNICALL deleteGlobalRef (JNIEnv *env, jobject globalRef);
 static jweak JNICALL newWeakGlobalRef (JNIEnv *env, jobject localOrGlobalRef);
 static jbooleanArray JNICALL newBooleanArray (JNIEnv *env, jsize length);
+static void returnCachedGlobalRefs(J9Pool *pool, j9object_t **cache, UDATA *cacheCount, UDATA keepCount);
 static jobject allocateGlobalRef (JNIEnv *env, jobject localOrGlobalRef, jboolean isWeak);
 static void ensurePendingJNIException (JNIEnv* env);
 static void deallocateGlobalRef (JNIEnv *env, jobject weakOrStrongGlobalRef, jboolean isWeak);
@@ -1654,24 +1655,95 @@ j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak)
 	Assert_VM_mustHaveVMAccess(vmThread);
 
 	if (globalRef != NULL) {
+		J9Pool *pool = isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences;
+		j9object_t **cache = isWeak ? vmThread->jniWeakGlobalRefCache : vmThread->jniGlobalRefCache;
+		UDATA *cacheCount = isWeak ? &vmThread->jniWeakGlobalRefCacheCount : &vmThread->jniGlobalRefCacheCount;
 
-#ifdef J9VM_THR_PREEMPTIVE
-		omrthread_monitor_enter(vm->jniFrameMutex);
-#endif
+		/* Only a live ref of this pool is deleted. Clearing the tag atomically ignores a ref deleted
+		 * twice, a ref of the other pool or a local ref, so that no slot is ever cached twice.
+		 */
+		if ((UDATA)pool != VM_AtomicSupport::lockCompareExchange(J9JNI_GLOBAL_REF_TAG_EA(globalRef), (UDATA)pool, 0)) {
+			return;
+		}
 
 #if defined(J9VM_GC_REALTIME)
 		if (J9_EXTENDED_RUNTIME_USER_REALTIME_ACCESS_BARRIER == (vm->extendedRuntimeFlags & J9_EXTENDED_RUNTIME_USER_REALTIME_ACCESS_BARRIER)) {
 			vm->memoryManagerFunctions->j9gc_objaccess_jniDeleteGlobalReference(vmThread, *((j9object_t*)globalRef));
 		}
 #endif /* defined(J9VM_GC_REALTIME) */
-		if (pool_includesElement(isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences, globalRef) == TRUE) {
-			pool_removeElement(isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences, globalRef);
+
+		/* The slot stays allocated in the pool, so the GC keeps scanning it, as a NULL reference,
+		 * until it is reused by this thread or returned to the pool.
+		 */
+		*(j9object_t*)globalRef = NULL;
+		if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_CHECK_JNI)) {
+			/* -Xcheck:jni looks refs up in the pools, so a deleted ref must not stay there */
+#ifdef J9VM_THR_PREEMPTIVE
+			omrthread_monitor_enter(vm->jniFrameMutex);
+#endif
+			pool_removeElement(pool, globalRef);
+#ifdef J9VM_THR_PREEMPTIVE
+			omrthread_monitor_exit(vm->jniFrameMutex);
+#endif
+			return;
 		}
+		if (J9VMTHREAD_JNI_GLOBAL_REF_CACHE_SIZE == *cacheCount) {
+#ifdef J9VM_THR_PREEMPTIVE
+			omrthread_monitor_enter(vm->jniFrameMutex);
+#endif
+			returnCachedGlobalRefs(pool, cache, cacheCount, J9VMTHREAD_JNI_GLOBAL_REF_CACHE_SIZE / 2);
+#ifdef J9VM_THR_PREEMPTIVE
+			omrthread_monitor_exit(vm->jniFrameMutex);
+#endif
+		}
+		cache[*cacheCount] = (j9object_t*)globalRef;
+		*cacheCount += 1;
+	}
+}
+
+
+void
+flushJNIGlobalRefCaches(J9VMThread *vmThread)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+
+	/* Stop-the-world collectors scan the pools without the jniFrameMutex */
+	Assert_VM_mustHaveVMAccess(vmThread);
 
+	if ((0 != vmThread->jniGlobalRefCacheCount) || (0 != vmThread->jniWeakGlobalRefCacheCount)) {
+#ifdef J9VM_THR_PREEMPTIVE
+		omrthread_monitor_enter(vm->jniFrameMutex);
+#endif
+		returnCachedGlobalRefs(vm->jniGlobalReferences, vmThread->jniGlobalRefCache, &vmThread->jniGlobalRefCacheCount, 0);
+		returnCachedGlobalRefs(vm->jniWeakGlobalReferences, vmThread->jniWeakGlobalRefCache, &vmThread->jniWeakGlobalRefCacheCount, 0);
 #ifdef J9VM_THR_PREEMPTIVE
 		omrthread_monitor_exit(vm->jniFrameMutex);
 #endif
+	}
+}
 
+
+/**
+ * Return JNI global reference slots cached by a thread to the VM-wide pool.
+ * The caller must hold the jniFrameMutex.
+ *
+ * @param pool[in] the pool of global or weak global references the slots belong to
+ * @param cache[in] the cache of the thread
+ * @param cacheCount[in/out] the number of slots in the cache
+ * @param keepCount[in] the number of slots to leave in the cache
+ */
+static void
+returnCachedGlobalRefs(J9Pool *pool, j9object_t **cache, UDATA *cacheCount, UDATA keepCount)
+{
+	while (*cacheCount > keepCount) {
+		j9object_t *slot = NULL;
+
+		*cacheCount -= 1;
+		slot = cache[*cacheCount];
+		/* The pools are freed before the last threads during VM shutdown */
+		if ((NULL != pool) && (pool_includesElement(pool, slot) == TRUE)) {
+			pool_removeElement(pool, slot);
+		}
 	}
 }
 
@@ -1687,19 +1759,47 @@ j9jni_createGlobalRef(JNIEnv *env, j9object_t object, jboolean isWeak)
 {
 	J9VMThread * vmThread = (J9VMThread *) env;
 	J9JavaVM * vm = vmThread->javaVM;
+	J9Pool *pool = isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences;
+	j9object_t **cache = isWeak ? vmThread->jniWeakGlobalRefCache : vmThread->jniGlobalRefCache;
+	UDATA *cacheCount = isWeak ? &vmThread->jniWeakGlobalRefCacheCount : &vmThread->jniGlobalRefCacheCount;
 	j9object_t * result;
 
 	Assert_VM_mustHaveVMAccess(vmThread);
 	Assert_VM_notNull(object);
 
+	/* Slots cached by this thread were set to NULL under mutex or when deleted, so they can be
+	 * reused without the mutex: a concurrent collector reads either NULL or the new object.
+	 */
+	if (0 != *cacheCount) {
+		*cacheCount -= 1;
+		result = cache[*cacheCount];
+		*result = object;
+		*J9JNI_GLOBAL_REF_TAG_EA(result) = (UDATA)pool;
+		return (jobject) result;
+	}
+
 #ifdef J9VM_THR_PREEMPTIVE
 	omrthread_monitor_enter(vm->jniFrameMutex);
 #endif
 
-	result = (j9object_t*)pool_newElement(isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences);
+	result = (j9object_t*)pool_newElement(pool);
 	if (result != NULL) {
 		/* Initialize the ref under mutex as a concurrent collector may read from the slot as soon as we release the mutex */
 		*result = object;
+		*J9JNI_GLOBAL_REF_TAG_EA(result) = (UDATA)pool;
+
+		/* Take a batch of slots for the following creations on this thread, unless -Xcheck:jni needs every deleted ref out of the pool */
+		while ((*cacheCount < (J9VMTHREAD_JNI_GLOBAL_REF_CACHE_SIZE / 2)) && J9_ARE_NO_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_CHECK_JNI)) {
+			j9object_t *slot = (j9object_t*)pool_newElement(pool);
+
+			if (NULL == slot) {
+				break;
+			}
+			*slot = NULL;
+			*J9JNI_GLOBAL_REF_TAG_EA(slot) = 0;
+			cache[*cacheCount] = slot;
+			*cacheCount += 1;
+		}
 	}
 
 #ifdef J9VM_THR_PREEMPTIVE
@@ -2365,7 +2465,7 @@ getObjectRefType(JNIEnv *env, jobject obj)
 
 	/* Check for global ref */
 
-	if (pool_includesElement(vm->jniGlobalReferences, obj)) {
+	if (pool_includesElement(vm->jniGlobalReferences, obj) && ((UDATA)vm->jniGlobalReferences == *J9JNI_GLOBAL_REF_TAG_EA(obj))) {
 #ifdef J9VM_THR_PREEMPTIVE
 		omrthread_monitor_exit(vm->jniFrameMutex);
 #endif
@@ -2375,7 +2475,7 @@ getObjectRefType(JNIEnv *env, jobject obj)
 
 	/* Check for weak global ref */
 
-	if (pool_includesElement(vm->jniWeakGlobalReferences, obj)) {
+	if (pool_includesElement(vm->jniWeakGlobalReferences, obj) && ((UDATA)vm->jniWeakGlobalReferences == *J9JNI_GLOBAL_REF_TAG_EA(obj))) {
 #ifdef J9VM_THR_PREEMPTIVE
 		omrthread_monitor_exit(vm->jniFrameMutex);
 #endif
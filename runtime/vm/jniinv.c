@@ -369,6 +369,7 @@ protectedDestroyJavaVM(J9PortLibrary* portLibrary, void * userData)
 	/* Do the java cleanup */
 	enterVMFromJNI(vmThread);
 	cleanUpAttachedThread(vmThread);
+	flushJNIGlobalRefCaches(vmThread);
 	releaseVMAccess(vmThread);
 
 	TRIGGER_J9HOOK_VM_SHUTTING_DOWN(vm->hookInterface, vmThread, 0);
@@ -712,6 +713,9 @@ protectedInternalAttachCurrentThread(J9PortLibrary* portLibrary, void * userData
 		j9mem_free_memory(modifiedThreadName);
 		if ((env->currentException != NULL) || (env->threadObject == NULL)) {
 			/* We did not run threadCleanup, so the zombie counter was not incremented */
+			internalEnterVMFromJNI(env);
+			flushJNIGlobalRefCaches(env);
+			internalReleaseVMAccess(env);
 			deallocateVMThread(env, FALSE, TRUE);
 			return JNI_ERR;
 		}
@@ -229,6 +229,8 @@ static jint runLoadStage (J9JavaVM *vm, IDATA flags);
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 static void freeClassNativeMemory (J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 #endif /* GC_DYNAMIC_CLASS_UNLOADING */
+static void seedClassProfileFromSharedCache (J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+static void persistClassProfilesToSharedCache (J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static jint runShutdownStage (J9JavaVM* vm, IDATA stage, void* reserved, UDATA filterFlags);
 static jint modifyDllLoadTable (J9JavaVM * vm, J9Pool* loadTable, J9VMInitArgs* j9vm_args);
 static jint processVMArgsFromFirstToLast(J9JavaVM * vm);
@@ -822,6 +824,8 @@ freeJavaVM(J9JavaVM * vm)
 #endif /* COUNT_BYTECODE_PAIRS */
 	deleteStatistics(vm);
 
+	freeAllContinuations(vm);
+
 	terminateVMThreading(vm);
 	tmpLib = vm->portLibrary;
 #ifdef J9VM_INTERP_VERBOSE
@@ -2265,7 +2269,7 @@ IDATA VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved) {
 			initializeVMLocalStorage(vm);
 #endif
 
-			if (NULL == (vm->jniGlobalReferences = pool_new(sizeof(UDATA), 0, 0, POOL_NO_ZERO, J9_GET_CALLSITE(), J9MEM_CATEGORY_JNI, POOL_FOR_PORT(vm->portLibrary)))) {
+			if (NULL == (vm->jniGlobalReferences = pool_new(J9JNI_GLOBAL_REF_ELEMENT_SIZE, 0, 0, POOL_NO_ZERO, J9_GET_CALLSITE(), J9MEM_CATEGORY_JNI, POOL_FOR_PORT(vm->portLibrary)))) {
 				goto _error;
 			}
 
@@ -2275,7 +2279,7 @@ IDATA VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved) {
 			initializeJNITable(vm);
 			/* vm->jniFunctionTable = GLOBAL_TABLE(EsJNIFunctions); */
 
-			if (NULL == (vm->jniWeakGlobalReferences = pool_new(sizeof(UDATA), 0, 0, POOL_NO_ZERO, J9_GET_CALLSITE(), J9MEM_CATEGORY_JNI, POOL_FOR_PORT(vm->portLibrary))))
+			if (NULL == (vm->jniWeakGlobalReferences = pool_new(J9JNI_GLOBAL_REF_ELEMENT_SIZE, 0, 0, POOL_NO_ZERO, J9_GET_CALLSITE(), J9MEM_CATEGORY_JNI, POOL_FOR_PORT(vm->portLibrary))))
 				goto _error;
 
 			if (NULL == (vm->classLoadingStackPool = pool_new(sizeof(J9StackElement),  0, 0, 0, J9_GET_CALLSITE(), J9MEM_CATEGORY_CLASSES, POOL_FOR_PORT(vm->portLibrary))))
@@ -3330,6 +3334,16 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 		}
 	}
 
+	{
+		IDATA deduplicateStackTraces = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXDEDUPLICATESTACKTRACES, NULL);
+		IDATA noDeduplicateStackTraces = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNODEDUPLICATESTACKTRACES, NULL);
+		if (deduplicateStackTraces > noDeduplicateStackTraces) {
+			vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_DEDUPLICATE_STACK_TRACES;
+		} else if (deduplicateStackTraces < noDeduplicateStackTraces) {
+			vm->extendedRuntimeFlags2 &= ~(UDATA)J9_EXTENDED_RUNTIME2_DEDUPLICATE_STACK_TRACES;
+		}
+	}
+
 	{
 		IDATA alwaysCopyJNICritical = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXALWAYSCOPYJNICRITICAL, NULL);
 		IDATA noAlwaysCopyJNICritical = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOALWAYSCOPYJNICRITICAL, NULL);
@@ -6889,6 +6903,20 @@ protectedInitializeJavaVM(J9PortLibrary* portLibrary, void * userData)
 		jvmPhaseChange(vm, J9VM_PHASE_NOT_STARTUP);
 	}
 
+	/* Persist the selected hot fields and the learned lockword state of shared classes across runs,
+	 * so that they are available from the first GC and the first instance.
+	 */
+	if ((NULL != vm->sharedClassConfig)
+		&& ((NULL != vm->hotFieldClassInfoPool) || vm->enableGlobalLockReservation)
+	) {
+		vmHooks = getVMHookInterface(vm);
+		if ((0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASS_PREPARE, seedClassProfileFromSharedCache, OMR_GET_CALLSITE(), NULL))
+			|| (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_SHUTTING_DOWN, persistClassProfilesToSharedCache, OMR_GET_CALLSITE(), NULL))
+		) {
+			goto error;
+		}
+	}
+
 	if (JNI_OK != (stageRC = runInitializationStage(vm, AGENTS_STARTED))) {
 		goto error;
 	}
@@ -7429,6 +7457,11 @@ freeClassNativeMemory(J9HookInterface** hook, UDATA eventNum, void* eventData, v
 	j9mem_free_memory(clazz->jniIDs);
 	clazz->jniIDs = NULL;
 
+	j9mem_free_memory(clazz->methodLookupIndex);
+	clazz->methodLookupIndex = NULL;
+	j9mem_free_memory(clazz->methodLookupCache);
+	clazz->methodLookupCache = NULL;
+
 	/* If the class is an interface, free the HCR method ordering table */
 	if (J9ROMCLASS_IS_INTERFACE(clazz->romClass)) {
 		j9mem_free_memory(J9INTERFACECLASS_METHODORDERING(clazz));
@@ -7438,6 +7471,22 @@ freeClassNativeMemory(J9HookInterface** hook, UDATA eventNum, void* eventData, v
 
 #endif /* GC_DYNAMIC_CLASS_UNLOADING */
 
+static void
+seedClassProfileFromSharedCache(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	J9VMClassPrepareEvent * data = eventData;
+
+	loadClassProfileFromSharedCache(data->currentThread, data->clazz);
+}
+
+static void
+persistClassProfilesToSharedCache(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	J9VMShutdownEvent * data = eventData;
+
+	storeClassProfilesToSharedCache(data->vmThread);
+}
+
 /**
  * Invoke jdk.internal.misc.Signal.dispatch(int number) in Java 9 and
  * onwards. Invoke sun.misc.Signal.dispatch(int number) in Java 8.
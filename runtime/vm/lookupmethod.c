@@ -52,10 +52,83 @@ typedef struct J9InterfaceResolveData {
 static char *
 defaultMethodConflictExceptionMessage(J9VMThread *currentThread, J9Class *targetClass, UDATA nameLength, U_8 *name, UDATA sigLength, U_8 *sig, J9Method **methods, UDATA methodsLength);
 static J9Method *
-searchClassForMethodCommon(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 * sig, UDATA sigLength, BOOLEAN partialMatch);
+searchClassForMethodCommon(J9VMThread *currentThread, J9Class * clazz, U_8 * name, UDATA nameLength, U_8 * sig, UDATA sigLength, BOOLEAN partialMatch);
+static UDATA hashMethodNameAndSignature(U_8 *name, UDATA nameLength, U_8 *sig, UDATA sigLength);
+static J9MethodLookupIndex* buildMethodLookupIndex(J9VMThread *currentThread, J9Class *clazz);
+static J9Method* findMethodInLookupCache(J9Class *clazz, U_8 *name, UDATA nameLength, U_8 *sig, UDATA sigLength, UDATA hash);
+static void addMethodToLookupCache(J9VMThread *currentThread, J9Class *clazz, J9Method *method, UDATA hash);
 static J9Method* javaResolveInterfaceMethods(J9VMThread *currentThread, J9Class *targetClass, J9ROMNameAndSignature *nameAndSig, J9Class *senderClass, UDATA lookupOptions, J9InterfaceResolveData *data);
 static char* getModuleNameUTF(J9VMThread *currentThread, j9object_t moduleObject, char *buffer, UDATA bufferLength);
 
+/**
+ * Find the method which an exact lookup from a class found in its superclasses in the method
+ * lookup cache of the class.
+ *
+ * @param clazz[in] the class the lookup started from
+ * @param name[in] the name of the method
+ * @param nameLength[in] the length of the method name
+ * @param sig[in] the signature of the method
+ * @param sigLength[in] the length of the method signature
+ * @param hash[in] the hash of the name and signature
+ *
+ * @returns the method (if cached) or NULL otherwise
+ */
+static J9Method*
+findMethodInLookupCache(J9Class *clazz, U_8 *name, UDATA nameLength, U_8 *sig, UDATA sigLength, UDATA hash)
+{
+	J9MethodLookupCache *cache = clazz->methodLookupCache;
+	J9Method *method = NULL;
+
+	if (NULL != cache) {
+		/* Entries are written without a lock, so each one is validated against the name and signature */
+		J9Method *entry = cache->methods[hash & (J9VM_METHOD_LOOKUP_CACHE_SIZE - 1)];
+
+		if (NULL != entry) {
+			J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(entry);
+			J9UTF8 *nameUTF = J9ROMMETHOD_NAME(romMethod);
+			J9UTF8 *sigUTF = J9ROMMETHOD_SIGNATURE(romMethod);
+
+			if (0 == compareMethodNameAndSignature(name, (U_16) nameLength, sig, (U_16) sigLength, J9UTF8_DATA(nameUTF), J9UTF8_LENGTH(nameUTF), J9UTF8_DATA(sigUTF), J9UTF8_LENGTH(sigUTF))) {
+				method = entry;
+			}
+		}
+	}
+	return method;
+}
+
+/**
+ * Record the method which an exact lookup from a class found in its superclasses in the method
+ * lookup cache of the class, which is allocated on first use. The method is the first one with
+ * its name and signature in the superclass walk from the class, which cannot change unless a
+ * class is redefined, so the cache does not depend on the sender class or the lookup options.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param clazz[in] the class the lookup started from
+ * @param method[in] the method found in a superclass of clazz
+ * @param hash[in] the hash of the name and signature of the method
+ */
+static void
+addMethodToLookupCache(J9VMThread *currentThread, J9Class *clazz, J9Method *method, UDATA hash)
+{
+	J9MethodLookupCache *cache = clazz->methodLookupCache;
+
+	if (NULL == cache) {
+		PORT_ACCESS_FROM_VMC(currentThread);
+
+		cache = (J9MethodLookupCache *)j9mem_allocate_memory(sizeof(J9MethodLookupCache), J9MEM_CATEGORY_CLASSES);
+		if (NULL != cache) {
+			memset(cache, 0, sizeof(J9MethodLookupCache));
+			if (0 != compareAndSwapUDATA((uintptr_t *)&clazz->methodLookupCache, (uintptr_t)NULL, (uintptr_t)cache)) {
+				j9mem_free_memory(cache);
+				cache = clazz->methodLookupCache;
+			}
+		}
+	}
+	if (NULL != cache) {
+		cache->methods[hash & (J9VM_METHOD_LOOKUP_CACHE_SIZE - 1)] = method;
+	}
+}
+
 /**
  * Search method in target class
  * Note: this method is also used for searching enclosing methods to skip validation required by javaLookupMethod.
@@ -71,13 +144,92 @@ static char* getModuleNameUTF(J9VMThread *currentThread, j9object_t moduleObject
 J9Method *
 searchClassForMethod(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 * sig, UDATA sigLength)
 {
-	return searchClassForMethodCommon(clazz, name, nameLength,sig, sigLength, FALSE);
+	return searchClassForMethodCommon(NULL, clazz, name, nameLength,sig, sigLength, FALSE);
+}
+
+/**
+ * Hash a method name and signature for the method lookup index.
+ *
+ * @param name[in] the name of the method
+ * @param nameLength[in] the length of the method name
+ * @param sig[in] the signature of the method
+ * @param sigLength[in] the length of the method signature
+ *
+ * @returns the hash
+ */
+static UDATA
+hashMethodNameAndSignature(U_8 *name, UDATA nameLength, U_8 *sig, UDATA sigLength)
+{
+	UDATA hash = 0;
+	UDATA i = 0;
+
+	for (i = 0; i < nameLength; i++) {
+		hash = (hash * 31) + name[i];
+	}
+	for (i = 0; i < sigLength; i++) {
+		hash = (hash * 31) + sig[i];
+	}
+	return hash;
+}
+
+/**
+ * Build the method lookup index of a class, and install it unless another thread did first.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param clazz[in] the class whose declared methods are indexed
+ *
+ * @returns the index installed in clazz, or NULL if it could not be allocated
+ */
+static J9MethodLookupIndex*
+buildMethodLookupIndex(J9VMThread *currentThread, J9Class *clazz)
+{
+	PORT_ACCESS_FROM_VMC(currentThread);
+	U_32 romMethodCount = clazz->romClass->romMethodCount;
+	U_32 slotCount = 1;
+	J9MethodLookupIndex *index = NULL;
+
+	/* Keep the load factor at or below 1/2 so that probe sequences stay short */
+	while (slotCount < (romMethodCount * 2)) {
+		slotCount <<= 1;
+	}
+	index = (J9MethodLookupIndex *)j9mem_allocate_memory(offsetof(J9MethodLookupIndex, slots) + (slotCount * sizeof(U_32)), J9MEM_CATEGORY_CLASSES);
+	if (NULL != index) {
+		J9Method *methods = clazz->ramMethods;
+		U_32 i = 0;
+
+		index->slotMask = slotCount - 1;
+		memset(index->slots, 0, slotCount * sizeof(U_32));
+		for (i = 0; i < romMethodCount; i++) {
+			J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(&methods[i]);
+			J9UTF8 *nameUTF = J9ROMMETHOD_NAME(romMethod);
+			J9UTF8 *sigUTF = J9ROMMETHOD_SIGNATURE(romMethod);
+			UDATA slot = hashMethodNameAndSignature(J9UTF8_DATA(nameUTF), J9UTF8_LENGTH(nameUTF), J9UTF8_DATA(sigUTF), J9UTF8_LENGTH(sigUTF)) & index->slotMask;
+
+			while (0 != index->slots[slot]) {
+				slot = (slot + 1) & index->slotMask;
+			}
+			index->slots[slot] = i + 1;
+		}
+
+		/* Lookups only read the index, so it can be published once built */
+		if (0 != compareAndSwapUDATA((uintptr_t *)&clazz->methodLookupIndex, (uintptr_t)NULL, (uintptr_t)index)) {
+			j9mem_free_memory(index);
+			index = clazz->methodLookupIndex;
+		}
+	}
+	return index;
 }
 
 /**
  * Search method in target class
  * Note: this method is also used for searching enclosing methods to skip validation required by javaLookupMethod.
  *
+ * Exact lookups in classes declaring at least J9VM_METHOD_LOOKUP_INDEX_MIN_METHODS methods
+ * use the hashed method lookup index of the class, which is built on first use if a
+ * currentThread is provided. The index follows the ROM methods across fast HCR and is
+ * freed when the class is unloaded.
+ *
+ * @param currentThread[in] the current J9VMThread, or NULL to never build the lookup index
  * @param clazz[in] the class or interface to start the search
  * @param name[in] the name of the method
  * @param nameLength[in] the length of the method name
@@ -88,7 +240,7 @@ searchClassForMethod(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 * sig, U
  * @returns the method (if found) or NULL otherwise
  */
 static J9Method *
-searchClassForMethodCommon(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 * sig, UDATA sigLength, BOOLEAN partialMatch)
+searchClassForMethodCommon(J9VMThread *currentThread, J9Class * clazz, U_8 * name, UDATA nameLength, U_8 * sig, UDATA sigLength, BOOLEAN partialMatch)
 {
 	J9ROMClass *romClass = clazz->romClass;
 	U_32 romMethodCount = romClass->romMethodCount;
@@ -96,7 +248,32 @@ searchClassForMethodCommon(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 *
 
 	if (romMethodCount != 0) {
 		J9Method * methods = clazz->ramMethods;
-		if (J9_ARE_ALL_BITS_SET(romClass->extraModifiers, J9AccClassUseBisectionSearch)) {
+		J9MethodLookupIndex *index = NULL;
+
+		if (!partialMatch && (romMethodCount >= J9VM_METHOD_LOOKUP_INDEX_MIN_METHODS)) {
+			index = clazz->methodLookupIndex;
+			if ((NULL == index) && (NULL != currentThread)) {
+				index = buildMethodLookupIndex(currentThread, clazz);
+			}
+		}
+
+		if (NULL != index) {
+			UDATA slot = hashMethodNameAndSignature(name, nameLength, sig, sigLength) & index->slotMask;
+			U_32 entry = index->slots[slot];
+
+			while (0 != entry) {
+				J9ROMMethod * romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(&(methods[entry - 1]));
+				J9UTF8 * nameUTF = J9ROMMETHOD_NAME(romMethod);
+				J9UTF8 * sigUTF = J9ROMMETHOD_SIGNATURE(romMethod);
+
+				if (0 == compareMethodNameAndSignature(name, (U_16) nameLength, sig, (U_16) sigLength, J9UTF8_DATA(nameUTF), J9UTF8_LENGTH(nameUTF), J9UTF8_DATA(sigUTF), J9UTF8_LENGTH(sigUTF))) {
+					searchResult = &(methods[entry - 1]);
+					break;
+				}
+				slot = (slot + 1) & index->slotMask;
+				entry = index->slots[slot];
+			}
+		} else if (J9_ARE_ALL_BITS_SET(romClass->extraModifiers, J9AccClassUseBisectionSearch)) {
 			IDATA startIndex = 0;
 			IDATA endIndex = (romMethodCount - 1);
 			IDATA midIndex = endIndex/2;
@@ -339,7 +516,7 @@ javaResolveInterfaceMethods(J9VMThread *currentThread, J9Class *targetClass, J9R
 	while (iTable != NULL) {
 		J9Class * interfaceClass = iTable->interfaceClass;
 		if (interfaceClass == targetClass) {
-			J9Method * foundMethod = searchClassForMethodCommon(interfaceClass, name, nameLength, sig, sigLength, J9_ARE_ANY_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE));
+			J9Method * foundMethod = searchClassForMethodCommon(currentThread, interfaceClass, name, nameLength, sig, sigLength, J9_ARE_ANY_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE));
 			if (NULL != foundMethod) {
 				/* As per spec, prevent super-interface private or static methods from being processed */
 				if (J9_ARE_NO_BITS_SET(J9_ROM_METHOD_FROM_RAM_METHOD(foundMethod)->modifiers, J9AccPrivate | J9AccStatic)) {
@@ -365,7 +542,7 @@ javaResolveInterfaceMethods(J9VMThread *currentThread, J9Class *targetClass, J9R
 			continue;
 		}
 
-		foundMethod = searchClassForMethodCommon(interfaceClass, name, nameLength, sig, sigLength, J9_ARE_ANY_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE));
+		foundMethod = searchClassForMethodCommon(currentThread, interfaceClass, name, nameLength, sig, sigLength, J9_ARE_ANY_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE));
 
 		/* As per spec, prevent super-interface private or static methods from being processed */
 		if (NULL != foundMethod) {
@@ -627,6 +804,8 @@ javaLookupMethodImpl(J9VMThread *currentThread, J9Class *targetClass, J9ROMNameA
 	J9Class * lookupClass = NULL;
 	BOOLEAN exceptionThrown = FALSE;
 	BOOLEAN isInterfaceLookup = FALSE;
+	BOOLEAN useLookupCache = FALSE;
+	UDATA lookupHash = 0;
 
 	Trc_VM_javaLookupMethod_Entry(currentThread, currentThread, targetClass, nameAndSig, senderClass, lookupOptions);
 
@@ -696,10 +875,27 @@ retry:
 	
 		/* Search for a matching method in the target class and its superclasses. */
 	
+		useLookupCache = !isInterfaceLookup && J9_ARE_NO_BITS_SET(lookupOptions, J9_LOOK_NO_CLIMB | J9_LOOK_PARTIAL_SIGNATURE);
+		if (useLookupCache) {
+			J9Method * cachedMethod = NULL;
+
+			lookupHash = hashMethodNameAndSignature(name, nameLength, sig, sigLength);
+			cachedMethod = findMethodInLookupCache(targetClass, name, nameLength, sig, sigLength, lookupHash);
+			if (NULL != cachedMethod) {
+				/* None of the classes below the declaring class declares the method, skip them */
+				lookupClass = J9_CLASS_FROM_METHOD(cachedMethod);
+				useLookupCache = FALSE;
+			}
+		}
+
 		while (lookupClass != NULL) {
-			J9Method * foundMethod = searchClassForMethodCommon(lookupClass, name, nameLength, sig, sigLength, J9_ARE_ANY_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE));
+			J9Method * foundMethod = searchClassForMethodCommon(currentThread, lookupClass, name, nameLength, sig, sigLength, J9_ARE_ANY_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE));
 
 			if (foundMethod != NULL) {
+				if (useLookupCache && (lookupClass != targetClass)) {
+					addMethodToLookupCache(currentThread, targetClass, foundMethod, lookupHash);
+				}
+				useLookupCache = FALSE;
 				resultMethod = processMethod(currentThread, lookupOptions, foundMethod, lookupClass, &exception, &exceptionClass, &errorType, nameAndSig, senderClass, targetClass);
 				if (NULL != currentThread->currentException) {
 					goto end;
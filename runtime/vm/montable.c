@@ -46,6 +46,7 @@ static UDATA hits, misses;
 #endif
 
 #define J9_OBJECT_MONITOR_LOOKUP_SLOT(object,vm) ( (((UDATA)object) >> vm->omrVM->_objectAlignmentShift) & (J9VMTHREAD_OBJECT_MONITOR_CACHE_SIZE-1))
+#define J9_MONITOR_TABLE_LOOKUP_INDEX_SLOT(hash) ((hash) & (J9VM_MONITOR_TABLE_LOOKUP_INDEX_SIZE - 1))
 
 static UDATA hashMonitorCompare (void *leftKey, void *rightKey, void *userData);
 static UDATA hashMonitorDestroyDo (void *entry, void *opaque);
@@ -146,6 +147,13 @@ initializeMonitorTable(J9JavaVM* vm)
 		return -1;
 	}
 	memset(vm->monitorTables, 0, sizeof(J9HashTable *) * tableCount);
+
+	/* The lookup index is read without holding the monitorTableMutex, see monitorTableAt() */
+	vm->monitorTableLookupIndex = (j9objectmonitor_t *)j9mem_allocate_memory(sizeof(j9objectmonitor_t) * J9VM_MONITOR_TABLE_LOOKUP_INDEX_SIZE, OMRMEM_CATEGORY_VM);
+	if (NULL == vm->monitorTableLookupIndex) {
+		return -1;
+	}
+	memset(vm->monitorTableLookupIndex, 0, sizeof(j9objectmonitor_t) * J9VM_MONITOR_TABLE_LOOKUP_INDEX_SIZE);
 	
 	vm->monitorTableList = NULL;
 
@@ -196,6 +204,12 @@ destroyMonitorTable(J9JavaVM* vm)
 		vm->monitorTables = NULL;
 	}
 
+	if (NULL != vm->monitorTableLookupIndex) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		j9mem_free_memory(vm->monitorTableLookupIndex);
+		vm->monitorTableLookupIndex = NULL;
+	}
+
 
 	/* free the monitorTableListPool */
 	if (NULL != vm->monitorTableListPool) {
@@ -218,6 +232,14 @@ destroyMonitorTable(J9JavaVM* vm)
  * The name of this routine is misleading, as it does NOT behave like the other
  * xxTableAt functions.  It should be called LookupAndAdd or something like that.
  *
+ * Lookups which miss the per-thread cache probe vm->monitorTableLookupIndex before taking
+ * the monitorTableMutex. The index is a direct-mapped array of monitors keyed by the object
+ * hash, which is stable across object moves. Slots are only written under the mutex, after
+ * the monitor has been fully initialized and added to its table, and are read without any
+ * lock. A reader holds VM access, so the GC cannot remove monitors from the tables while it
+ * uses a slot; the GC clears the index along with the per-thread caches before it removes
+ * dead monitors (see scanMonitorLookupCaches).
+ *
  * @pre: The caller must have VM access.
  */
 J9ObjectMonitor *
@@ -230,6 +252,7 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 	J9ThreadAbstractMonitor key_monitor;
 	struct J9HashTable* monitorTable = NULL;
 	UDATA index = 0;
+	j9objectmonitor_t *lookupSlot = NULL;
 #if defined(J9VM_INTERP_CUSTOM_SPIN_OPTIONS)
 	J9Class *ramClass = J9OBJECT_CLAZZ(vmStruct, object);
 	J9VMCustomSpinOptions *option = ramClass->customSpinOption;
@@ -269,6 +292,21 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 	key_monitor.userData = (UDATA) object;
 	key_objectMonitor.monitor = (omrthread_monitor_t) &key_monitor;
 	key_objectMonitor.hash = objectHashCode(vm, object);
+
+	/* Probe the lookup index without taking the mutex */
+	lookupSlot = &vm->monitorTableLookupIndex[J9_MONITOR_TABLE_LOOKUP_INDEX_SLOT(key_objectMonitor.hash)];
+	objectMonitor = (J9ObjectMonitor *)(UDATA)*(j9objectmonitor_t volatile *)lookupSlot;
+	if (NULL != objectMonitor) {
+		/* Pairs with the write barrier issued before the slot was published */
+		issueReadBarrier();
+		if (J9WEAKROOT_OBJECT_LOAD_VM(vm, &((J9ThreadAbstractMonitor*)objectMonitor->monitor)->userData) == object) {
+			TRACE("Lookup index hit");
+			cacheObjectMonitorForLookup(vm, vmStruct, objectMonitor);
+			Trc_VM_monitorTableAt_LookupIndexHit_Exit(vmStruct, objectMonitor);
+			return objectMonitor;
+		}
+	}
+
 	index = key_objectMonitor.hash % (U_32)vm->monitorTableCount;
 	monitorTable = vm->monitorTables[index];
 
@@ -321,12 +359,25 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 				key_objectMonitor.proDeflationCount = 0;
 				key_objectMonitor.antiDeflationCount = 0;
 #endif
+				/* Start with the full spin budget, spinOnTryEnter adapts it to the observed contention */
+				key_objectMonitor.spinBudget = (U_32)OMR_MIN(vm->thrMaxTryEnterYieldsBeforeBlocking, U_32_MAX);
+				key_objectMonitor.spinAcquireCount = 0;
+				key_objectMonitor.spinFailCount = 0;
 
 				objectMonitor = hashTableAdd(monitorTable, &key_objectMonitor);
 				if (objectMonitor == NULL) {
 					omrthread_monitor_destroy(monitor);
 					TRACE("Out of memory adding to hash table");
 				}
+#if defined(J9VM_ENV_DATA64)
+				if ((NULL != objectMonitor) && vm->enableGlobalLockReservation) {
+					/* Count the monitors created for instances of the class, for the lock profile persisted in the shared cache */
+					J9Class *clazz = J9OBJECT_CLAZZ(vmStruct, object);
+					if (clazz->monitorTableCounter < U_32_MAX) {
+						clazz->monitorTableCounter += 1;
+					}
+				}
+#endif /* defined(J9VM_ENV_DATA64) */
 			} else {
 				TRACE("Out of memory creating omrthread_monitor_t");
 				objectMonitor = NULL;
@@ -338,6 +389,9 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 
 	if (NULL != objectMonitor) {
 		cacheObjectMonitorForLookup(vm, vmStruct, objectMonitor);
+		/* Publish the monitor to lock-free readers once its initialization is visible */
+		issueWriteBarrier();
+		*lookupSlot = (j9objectmonitor_t)(UDATA)objectMonitor;
 	}
 
 	omrthread_monitor_exit(mutex);
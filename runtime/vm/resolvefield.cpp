@@ -747,6 +747,49 @@ releaseMutex:
 	}
 }
 
+BOOLEAN
+getHotFieldsClassProfile(J9JavaVM *vm, J9Class *clazz, J9SharedClassProfile *profile)
+{
+	J9ClassHotFieldsInfo *hotFieldsInfo = clazz->hotFieldsInfo;
+	BOOLEAN selected = FALSE;
+
+	if ((NULL != vm->hotFieldClassInfoPool)
+		&& (NULL != hotFieldsInfo)
+		&& (U_8_MAX != hotFieldsInfo->hotFieldOffset1)
+	) {
+		profile->hotFieldOffset1 = hotFieldsInfo->hotFieldOffset1;
+		profile->hotFieldOffset2 = hotFieldsInfo->hotFieldOffset2;
+		profile->hotFieldOffset3 = hotFieldsInfo->hotFieldOffset3;
+		selected = TRUE;
+	}
+	return selected;
+}
+
+void
+seedHotFieldsFromClassProfile(J9VMThread *currentThread, J9Class *clazz, const J9SharedClassProfile *profile)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	UDATA instanceSlots = (clazz->totalInstanceSize + J9JAVAVM_OBJECT_HEADER_SIZE(vm)) / J9JAVAVM_REFERENCE_SIZE(vm);
+
+	/* The ROM class is the same, but the instance shape also depends on the superclasses */
+	if ((NULL != vm->hotFieldClassInfoPool)
+		&& (NULL == clazz->hotFieldsInfo)
+		&& (profile->totalInstanceSize == clazz->totalInstanceSize)
+		&& (U_8_MAX != profile->hotFieldOffset1)
+		&& (profile->hotFieldOffset1 < instanceSlots)
+		&& ((U_8_MAX == profile->hotFieldOffset2) || (profile->hotFieldOffset2 < instanceSlots))
+		&& ((U_8_MAX == profile->hotFieldOffset3) || (profile->hotFieldOffset3 < instanceSlots))
+	) {
+		createClassHotFieldsInfo(vm, clazz, profile->hotFieldOffset1, 0, 0);
+		if (NULL != clazz->hotFieldsInfo) {
+			clazz->hotFieldsInfo->hotFieldOffset1 = profile->hotFieldOffset1;
+			clazz->hotFieldsInfo->hotFieldOffset2 = profile->hotFieldOffset2;
+			clazz->hotFieldsInfo->hotFieldOffset3 = profile->hotFieldOffset3;
+			Trc_VM_seedHotFieldsFromClassProfile_seeded(currentThread, clazz, profile->hotFieldOffset1, profile->hotFieldOffset2, profile->hotFieldOffset3);
+		}
+	}
+}
+
 J9ROMFieldOffsetWalkResult *
 #ifdef J9VM_OPT_VALHALLA_VALUE_TYPES
 fieldOffsetsStartDo(J9JavaVM *vm, J9ROMClass *romClass, J9Class *superClazz, J9ROMFieldOffsetWalkState *state, U_32 flags, J9FlattenedClassCache *flattenedClassCache)
@@ -77,6 +77,25 @@ extern "C" {
 #define TAG_PACKED_QUERY 		12
 #define TAG_UNICODE_QUERY 		20
 
+/* Profile of a class stored in the shared class cache by a previous run, as attached data of
+ * type J9SHR_ATTACHED_DATA_TYPE_CLASSPROFILE keyed by the ROM class.
+ */
+typedef struct J9SharedClassProfile {
+	U_32 totalInstanceSize;
+	U_8 hotFieldOffset1; /* U_8_MAX if no hot field was selected */
+	U_8 hotFieldOffset2;
+	U_8 hotFieldOffset3;
+	U_8 lockProfile; /* J9_CLASS_PROFILE_LOCK_* */
+} J9SharedClassProfile;
+
+/* Initial lockword state learned for the instances of a class */
+#define J9_CLASS_PROFILE_LOCK_STATE_MASK 0x3
+#define J9_CLASS_PROFILE_LOCK_STATE_LEARNING 0x0
+#define J9_CLASS_PROFILE_LOCK_STATE_RESERVED 0x1
+#define J9_CLASS_PROFILE_LOCK_STATE_FLAT 0x2
+/* Set if the instances of the class were often inflated */
+#define J9_CLASS_PROFILE_LOCK_CONTENDED 0x4
+
 /* ---------------- resolvefield.c ---------------- */
 
 /**
@@ -97,6 +116,82 @@ fieldIndexTableNew(J9JavaVM* vm, J9PortLibrary *portLib);
 void
 fieldIndexTableFree(J9JavaVM* vm);
 
+/**
+ * Record the selected hot field offsets of a class in its shared class profile.
+ * Valid if dynamicBreadthFirstScanOrdering is enabled.
+ *
+ * @param vm[in] the J9JavaVM
+ * @param clazz[in] the class
+ * @param profile[out] the profile receiving the hot field offsets
+ * @return TRUE if hot fields have been selected for the class, FALSE otherwise
+ */
+BOOLEAN
+getHotFieldsClassProfile(J9JavaVM *vm, J9Class *clazz, J9SharedClassProfile *profile);
+
+/**
+ * Seed the hot field offsets of a class from the profile a previous run stored in the shared
+ * class cache, so that the GC copies the hottest fields of its instances next to them from the
+ * first collection instead of waiting for the JIT to report them. The profile is ignored if the
+ * instance shape of the class has changed.
+ * Valid if dynamicBreadthFirstScanOrdering is enabled.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param clazz[in] the class
+ * @param profile[in] the profile found in the shared class cache
+ */
+void
+seedHotFieldsFromClassProfile(J9VMThread *currentThread, J9Class *clazz, const J9SharedClassProfile *profile);
+
+/* ---------------- ObjectMonitor.cpp ---------------- */
+
+/**
+ * Record the initial lockword state the lock reservation history of a class selects, and whether
+ * its instances were often inflated, in its shared class profile.
+ * Valid if enableGlobalLockReservation is set.
+ *
+ * @param vm[in] the J9JavaVM
+ * @param clazz[in] the class
+ * @param profile[out] the profile receiving the lock profile
+ * @return TRUE if anything was learned for the class, FALSE otherwise
+ */
+BOOLEAN
+getLockClassProfile(J9JavaVM *vm, J9Class *clazz, J9SharedClassProfile *profile);
+
+/**
+ * Seed the lock reservation history of a class from the profile a previous run stored in the
+ * shared class cache, so that its instances start in the lockword state the previous run
+ * converged to instead of learning it again.
+ * Valid if enableGlobalLockReservation is set.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param clazz[in] the class
+ * @param profile[in] the profile found in the shared class cache
+ */
+void
+seedLockFromClassProfile(J9VMThread *currentThread, J9Class *clazz, const J9SharedClassProfile *profile);
+
+/* ---------------- SharedClassProfile.cpp ---------------- */
+
+/**
+ * Seed the profile of a class from the profile a previous run stored in the shared class cache.
+ * The profile is attached data of the ROM class, so only classes whose ROM class is in the
+ * shared cache are considered. Called when the class is prepared, before any instance exists.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param clazz[in] the class which was just prepared
+ */
+void
+loadClassProfileFromSharedCache(J9VMThread *currentThread, J9Class *clazz);
+
+/**
+ * Store the profiles of all loaded classes whose ROM class is in the shared class cache, so that
+ * the next run can seed them. A profile already in the cache is updated in place.
+ *
+ * @param currentThread[in] the current J9VMThread
+ */
+void
+storeClassProfilesToSharedCache(J9VMThread *currentThread);
+
 /* ---------------- jniinv.c ---------------- */
 
 /**
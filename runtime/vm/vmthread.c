@@ -419,6 +419,8 @@ void threadCleanup(J9VMThread * vmThread, UDATA forkedByVM)
 
 	acquireVMAccess(vmThread);
 	cleanUpAttachedThread(vmThread);
+	/* Return the JNI global reference slots cached by this thread while the GC cannot be walking the pools */
+	flushJNIGlobalRefCaches(vmThread);
 	releaseVMAccess(vmThread);
 	
 #if defined(OMR_GC_CONCURRENT_SCAVENGER) && defined(J9VM_ARCH_S390)
@@ -506,6 +508,8 @@ threadParseArguments(J9JavaVM *vm, char *optArg)
 	vm->thrMaxTryEnterYieldsBeforeBlocking = 45;
 	vm->thrNestedSpinning = 1;
 	vm->thrTryEnterNestedSpinning = 1;
+	vm->thrAdaptiveObjectMonitorSpin = 1;
+	vm->thrMembarrier = 1;
 	vm->thrDeflationPolicy = J9VM_DEFLATION_POLICY_ASAP;
 
 	if (cpus > 1) {
@@ -741,6 +745,26 @@ threadParseArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "adaptiveObjectMonitorSpin")) {
+			vm->thrAdaptiveObjectMonitorSpin = 1;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noAdaptiveObjectMonitorSpin")) {
+			vm->thrAdaptiveObjectMonitorSpin = 0;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "membarrier")) {
+			vm->thrMembarrier = 1;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noMembarrier")) {
+			vm->thrMembarrier = 0;
+			continue;
+		}
+
 
 		if (try_scan(&scan_start, "staggerStep=")) {
 			if (scan_udata(&scan_start, &vm->thrStaggerStep)) {
@@ -1309,6 +1333,8 @@ dumpThreadingInfo(J9JavaVM* jvm)
 	j9tty_printf(PORTLIB, LEADING_SPACE "tryEnterYield=%zu,\n", jvm->thrMaxTryEnterYieldsBeforeBlocking);
 	j9tty_printf(PORTLIB, LEADING_SPACE "%sestedSpinning,\n", (jvm->thrNestedSpinning) ? "n" : "noN");
 	j9tty_printf(PORTLIB, LEADING_SPACE "%sryEnterNestedSpinning,\n", (jvm->thrTryEnterNestedSpinning) ? "t" : "noT");
+	j9tty_printf(PORTLIB, LEADING_SPACE "%sdaptiveObjectMonitorSpin,\n", (jvm->thrAdaptiveObjectMonitorSpin) ? "a" : "noA");
+	j9tty_printf(PORTLIB, LEADING_SPACE "%sembarrier,\n", (jvm->thrMembarrier) ? "m" : "noM");
 	j9tty_printf(PORTLIB, LEADING_SPACE "%sestroyMutexOnMonitorFree,\n", 
 		J9_ARE_ALL_BITS_SET(omrthread_lib_get_flags(), J9THREAD_LIB_FLAG_DESTROY_MUTEX_ON_MONITOR_FREE) ? "d" : "noD");
 #if !defined(WIN32) && defined(OMR_NOTIFY_POLICY_CONTROL)
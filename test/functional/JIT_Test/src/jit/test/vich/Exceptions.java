@@ -22,6 +22,7 @@
 
 package jit.test.vich;
 
+import org.testng.Assert;
 import org.testng.annotations.Test;
 import org.testng.log4testng.Logger;
 import jit.test.vich.utils.Timer;
@@ -57,4 +58,44 @@ public void testException (int i ) throws Exception {
 	testException (i - 1);
 	return;
 }
+
+/**
+ * Exceptions thrown from a few sites at the same depth have identical stack traces,
+ * which -XX:+DeduplicateStackTraces lets them share.
+ */
+@Test(groups = { "level.sanity","component.jit" })
+public void testExceptionsFromFewSites() {
+	int[] caught = new int[4];
+	timer.reset();
+	for (int i = 0; i < 100000; i++) {
+		try {
+			throwFromSite(32, i & 3);
+		} catch (IllegalStateException e) {
+			caught[Integer.parseInt(e.getMessage())] += 1;
+		}
+	}
+	timer.mark();
+	logger.info("100000 Exception Throws of depth 32 from 4 sites = " + Long.toString(timer.delta()));
+	for (int site = 0; site < caught.length; site++) {
+		Assert.assertEquals(caught[site], 25000, "Exceptions caught from site " + site);
+	}
+	return;
+}
+
+public void throwFromSite (int depth, int site) {
+	if (depth > 0) {
+		throwFromSite (depth - 1, site);
+		return;
+	}
+	switch (site) {
+	case 0:
+		throw new IllegalStateException("0");
+	case 1:
+		throw new IllegalStateException("1");
+	case 2:
+		throw new IllegalStateException("2");
+	default:
+		throw new IllegalStateException("3");
+	}
+}
 }
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package jit.test.vich;
+
+import java.util.Map;
+import java.util.zip.CRC32;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import jit.test.vich.utils.Timer;
+
+/**
+ * Times exclusive VM access requests, made by Thread.getAllStackTraces(), while many threads
+ * repeatedly enter and leave a JNI native. With atomic-free JNI each request flushes the
+ * write buffers of the other processors, with membarrier on Linux unless -Xthr:noMembarrier
+ * is given. Checks that each request sees all the running threads.
+ */
+public class ExclusiveAccessLatency {
+
+	private static Logger logger = Logger.getLogger(ExclusiveAccessLatency.class);
+	Timer timer;
+
+	public ExclusiveAccessLatency() {
+		timer = new Timer ();
+	}
+
+	static final int threadCount = 64;
+	static final int requestCount = 50;
+
+	private static volatile boolean running;
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testExclusiveAccessLatency() throws InterruptedException
+	{
+		Thread[] threads = new Thread[threadCount];
+		long slowest = 0;
+
+		running = true;
+		for (int i = 0; i < threadCount; i++) {
+			threads[i] = new Thread() {
+				public void run() {
+					CRC32 crc = new CRC32();
+					byte[] data = new byte[64];
+					while (running) {
+						/* CRC32.update(byte[], int, int) calls into a JNI native */
+						crc.update(data, 0, data.length);
+					}
+				}
+			};
+			threads[i].start();
+		}
+
+		try {
+			timer.reset();
+			for (int i = 0; i < requestCount; i++) {
+				long start = System.nanoTime();
+				Map<Thread, StackTraceElement[]> traces = Thread.getAllStackTraces();
+				slowest = Math.max(slowest, System.nanoTime() - start);
+				for (int j = 0; j < threadCount; j++) {
+					Assert.assertTrue(traces.containsKey(threads[j]), "A running thread is missing from Thread.getAllStackTraces()");
+				}
+			}
+			timer.mark();
+		} finally {
+			running = false;
+			for (int i = 0; i < threadCount; i++) {
+				threads[i].join();
+			}
+		}
+		logger.info(requestCount + " Thread.getAllStackTraces() calls with " + threadCount + " threads in JNI natives = " + timer.delta()
+				+ ", slowest call (us) = " + (slowest / 1000));
+	}
+}
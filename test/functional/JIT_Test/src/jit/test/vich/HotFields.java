@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package jit.test.vich;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import jit.test.vich.utils.Timer;
+
+/**
+ * Times traversals of a chain of nodes through their hot field, next, after the nodes
+ * have been copied by collections. When the collector knows next is hot, it copies each
+ * node right after its parent, so later traversals touch fewer cache lines. Hot field
+ * selections are kept in the shared class cache, so with -Xshareclasses a second run
+ * starts with them instead of waiting for the JIT to report.
+ */
+public class HotFields {
+
+	private static Logger logger = Logger.getLogger(HotFields.class);
+	Timer timer;
+
+	public HotFields() {
+		timer = new Timer ();
+	}
+
+	static final int nodeCount = 100000;
+	static final int roundCount = 5;
+	static final int traversalCount = 100;
+
+	static final class Payload {
+		long a, b, c, d;
+	}
+
+	static final class Node {
+		Payload cold1, cold2, cold3;
+		Node next;
+		Payload cold4, cold5, cold6;
+		int value;
+	}
+
+	private static volatile Object sink;
+
+	private static void churn() {
+		/* short lived garbage, so that the nodes are copied by scavenges until they are tenured */
+		for (int i = 0; i < 16 * 1024; i++) {
+			sink = new byte[1024];
+		}
+	}
+
+	private static Node build(int nodes) {
+		/* allocate the cold payload in between, so that the hot chain starts out scattered */
+		Node head = null;
+		for (int i = 0; i < nodes; i++) {
+			Node node = new Node();
+			node.cold1 = new Payload();
+			node.cold2 = new Payload();
+			node.cold3 = new Payload();
+			node.cold4 = new Payload();
+			node.cold5 = new Payload();
+			node.cold6 = new Payload();
+			node.value = i;
+			node.next = head;
+			head = node;
+		}
+		return head;
+	}
+
+	private static long traverse(Node head) {
+		long sum = 0;
+		for (Node node = head; null != node; node = node.next) {
+			sum += node.value;
+		}
+		return sum;
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testHotFields()
+	{
+		long expected = ((long)nodeCount * (nodeCount - 1)) / 2;
+		Node head = build(nodeCount);
+
+		for (int round = 1; round <= roundCount; round++) {
+			churn();
+			timer.reset();
+			for (int i = 0; i < traversalCount; i++) {
+				Assert.assertEquals(traverse(head), expected, "The node chain changed during a collection");
+			}
+			timer.mark();
+			logger.info("round " + round + ": " + traversalCount + " traversals of " + nodeCount + " nodes = " + timer.delta());
+		}
+	}
+}
@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package jit.test.vich;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import java.util.concurrent.atomic.AtomicBoolean;
+import jit.test.vich.utils.Timer;
+
+/**
+ * Times JNI NewGlobalRef/DeleteGlobalRef and NewWeakGlobalRef/DeleteWeakGlobalRef
+ * pairs from one thread and from several threads at once, and checks that live refs
+ * still resolve to their objects while other refs are deleted and created around them.
+ */
+public class JNIGlobalRef {
+
+	private static Logger logger = Logger.getLogger(JNIGlobalRef.class);
+	Timer timer;
+
+	static {
+		try {
+			System.loadLibrary("j9ben");
+		} catch (UnsatisfiedLinkError e) {}
+	}
+
+	public JNIGlobalRef() {
+		timer = new Timer ();
+	}
+
+	static final int loopCount = 1000000;
+	static final int threadCount = 8;
+
+	public native void newDeleteGlobalRef(Object obj, int loopCount);
+	public native void newDeleteWeakGlobalRef(Object obj, int loopCount);
+	public native void newDeleteGlobalRefBatch(Object obj, int loopCount);
+	public native boolean checkInterleavedGlobalRefs(Object[] objs, int loopCount);
+
+	private void runThreads(final int kind) throws InterruptedException
+	{
+		Thread[] threads = new Thread[threadCount];
+		for (int i = 0; i < threadCount; i++) {
+			threads[i] = new Thread() {
+				public void run() {
+					Object obj = new Object();
+					switch (kind) {
+					case 0:
+						newDeleteGlobalRef(obj, loopCount);
+						break;
+					case 1:
+						newDeleteWeakGlobalRef(obj, loopCount);
+						break;
+					default:
+						newDeleteGlobalRefBatch(obj, loopCount / 64);
+						break;
+					}
+				}
+			};
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].start();
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].join();
+		}
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testJNIGlobalRef() throws InterruptedException
+	{
+		Object obj = new Object();
+
+		try
+		{
+			newDeleteGlobalRef(obj, 1);
+		} catch (UnsatisfiedLinkError e) {
+			Assert.fail("No natives for JNI tests");
+		}
+
+		timer.reset();
+		newDeleteGlobalRef(obj, loopCount);
+		timer.mark();
+		logger.info(loopCount + " NewGlobalRef/DeleteGlobalRef calls = " + timer.delta());
+
+		timer.reset();
+		newDeleteWeakGlobalRef(obj, loopCount);
+		timer.mark();
+		logger.info(loopCount + " NewWeakGlobalRef/DeleteWeakGlobalRef calls = " + timer.delta());
+
+		timer.reset();
+		runThreads(0);
+		timer.mark();
+		logger.info(threadCount + " threads x " + loopCount + " NewGlobalRef/DeleteGlobalRef calls = " + timer.delta());
+
+		timer.reset();
+		runThreads(1);
+		timer.mark();
+		logger.info(threadCount + " threads x " + loopCount + " NewWeakGlobalRef/DeleteWeakGlobalRef calls = " + timer.delta());
+
+		timer.reset();
+		runThreads(2);
+		timer.mark();
+		logger.info(threadCount + " threads x " + loopCount + " batched NewGlobalRef/DeleteGlobalRef calls = " + timer.delta());
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testInterleavedJNIGlobalRefs() throws InterruptedException
+	{
+		final AtomicBoolean passed = new AtomicBoolean(true);
+		Thread[] threads = new Thread[threadCount];
+
+		for (int i = 0; i < threadCount; i++) {
+			threads[i] = new Thread() {
+				public void run() {
+					Object[] objs = new Object[64];
+					for (int j = 0; j < objs.length; j++) {
+						objs[j] = new Object();
+					}
+					if (!checkInterleavedGlobalRefs(objs, loopCount / 64)) {
+						passed.set(false);
+					}
+				}
+			};
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].start();
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].join();
+		}
+		Assert.assertTrue(passed.get(), "A JNI global ref did not resolve to its object");
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testThreadChurnJNIGlobalRefs() throws InterruptedException
+	{
+		final AtomicBoolean passed = new AtomicBoolean(true);
+		final AtomicBoolean churning = new AtomicBoolean(true);
+
+		/* Threads that exit with slots in their caches return them while the GC may be scanning the pools */
+		Thread collector = new Thread() {
+			public void run() {
+				while (churning.get()) {
+					System.gc();
+				}
+			}
+		};
+		Thread checker = new Thread() {
+			public void run() {
+				Object[] objs = new Object[64];
+				for (int j = 0; j < objs.length; j++) {
+					objs[j] = new Object();
+				}
+				while (churning.get()) {
+					if (!checkInterleavedGlobalRefs(objs, 16)) {
+						passed.set(false);
+					}
+				}
+			}
+		};
+		collector.start();
+		checker.start();
+		for (int i = 0; i < 200; i++) {
+			Thread[] threads = new Thread[threadCount];
+			for (int j = 0; j < threadCount; j++) {
+				threads[j] = new Thread() {
+					public void run() {
+						Object obj = new Object();
+						newDeleteGlobalRefBatch(obj, 1);
+						newDeleteWeakGlobalRef(obj, 1);
+					}
+				};
+				threads[j].start();
+			}
+			for (int j = 0; j < threadCount; j++) {
+				threads[j].join();
+			}
+		}
+		churning.set(false);
+		collector.join();
+		checker.join();
+		Assert.assertTrue(passed.get(), "A JNI global ref did not resolve to its object");
+	}
+}
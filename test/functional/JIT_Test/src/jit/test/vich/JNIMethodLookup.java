@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package jit.test.vich;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import jit.test.vich.utils.Timer;
+
+/**
+ * Times JNI GetMethodID/GetStaticMethodID and Class.getMethod on methods declared by the
+ * class itself, by a superclass several levels up and by java.lang.Object, and checks that
+ * repeated lookups keep finding the same methods and never find a missing one.
+ */
+public class JNIMethodLookup {
+
+	private static Logger logger = Logger.getLogger(JNIMethodLookup.class);
+	Timer timer;
+
+	static {
+		try {
+			System.loadLibrary("j9ben");
+		} catch (UnsatisfiedLinkError e) {}
+	}
+
+	public JNIMethodLookup() {
+		timer = new Timer ();
+	}
+
+	static final int loopCount = 100000;
+
+	public native boolean getMethodID(Class<?> clazz, String name, String sig, int loopCount);
+	public native boolean getStaticMethodID(Class<?> clazz, String name, String sig, int loopCount);
+
+	public static class Level0 {
+		public int m0() { return 0; }
+		public int m1() { return 1; }
+		public int m2() { return 2; }
+		public int m3() { return 3; }
+		public int m4() { return 4; }
+		public int m5() { return 5; }
+		public int m6() { return 6; }
+		public int m7() { return 7; }
+		public int level0() { return 0; }
+		public static int staticLevel0() { return 0; }
+	}
+
+	public static class Level1 extends Level0 {
+		public int m0() { return 10; }
+		public int m1() { return 11; }
+		public int m2() { return 12; }
+		public int m3() { return 13; }
+		public int n0() { return 14; }
+		public int n1() { return 15; }
+		public int n2() { return 16; }
+		public int n3() { return 17; }
+	}
+
+	public static class Level2 extends Level1 {
+		public int m4() { return 24; }
+		public int m5() { return 25; }
+		public int n0() { return 26; }
+		public int n1() { return 27; }
+		public int o0() { return 28; }
+		public int o1() { return 29; }
+		public int o2() { return 30; }
+		public int o3() { return 31; }
+	}
+
+	public static class Level3 extends Level2 {
+		public int m6() { return 36; }
+		public int n2() { return 37; }
+		public int o0() { return 38; }
+		public int p0() { return 39; }
+		public int p1() { return 40; }
+		public int p2() { return 41; }
+		public int p3() { return 42; }
+		public int level3() { return 3; }
+	}
+
+	private void time(String what, Class<?> clazz, String name, String sig)
+	{
+		timer.reset();
+		boolean found = getMethodID(clazz, name, sig, loopCount);
+		timer.mark();
+		Assert.assertTrue(found, "GetMethodID did not find " + clazz.getName() + "." + name + sig);
+		logger.info(loopCount + " GetMethodID calls for " + what + " = " + timer.delta());
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testJNIMethodLookup()
+	{
+		try
+		{
+			getMethodID(Level3.class, "level3", "()I", 1);
+		} catch (UnsatisfiedLinkError e) {
+			Assert.fail("No natives for JNI tests");
+		}
+
+		time("a declared method", Level3.class, "level3", "()I");
+		time("a method overridden one level up", Level3.class, "m0", "()I");
+		time("a method declared three levels up", Level3.class, "level0", "()I");
+		time("a java.lang.Object method", Level3.class, "hashCode", "()I");
+		time("an inherited JDK method", java.util.ArrayList.class, "containsAll", "(Ljava/util/Collection;)Z");
+
+		timer.reset();
+		boolean found = getStaticMethodID(Level3.class, "staticLevel0", "()I", loopCount);
+		timer.mark();
+		Assert.assertTrue(found, "GetStaticMethodID did not find Level0.staticLevel0");
+		logger.info(loopCount + " GetStaticMethodID calls for a static method declared three levels up = " + timer.delta());
+
+		/* repeated lookups must keep failing for missing methods, and a hit on another class must not leak */
+		Assert.assertFalse(getMethodID(Level3.class, "missing", "()I", 10), "GetMethodID found a missing method");
+		Assert.assertFalse(getMethodID(Level3.class, "level0", "()J", 10), "GetMethodID matched the wrong signature");
+		Assert.assertFalse(getMethodID(Level0.class, "level3", "()I", 10), "GetMethodID found a subclass method");
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testReflectMethodLookup() throws Exception
+	{
+		Level3 receiver = new Level3();
+
+		timer.reset();
+		for (int i = 0; i < loopCount; i++) {
+			Level3.class.getMethod("level0");
+			Level3.class.getMethod("m1");
+			Level3.class.getMethod("hashCode");
+		}
+		timer.mark();
+		logger.info(loopCount + " x 3 Class.getMethod calls = " + timer.delta());
+
+		/* the method found must be the most specific one on every lookup */
+		for (int i = 0; i < 10; i++) {
+			Assert.assertEquals(Level3.class.getMethod("m0").invoke(receiver), Integer.valueOf(10));
+			Assert.assertEquals(Level3.class.getMethod("m4").invoke(receiver), Integer.valueOf(24));
+			Assert.assertEquals(Level3.class.getMethod("m6").invoke(receiver), Integer.valueOf(36));
+			Assert.assertEquals(Level3.class.getMethod("m7").invoke(receiver), Integer.valueOf(7));
+			Assert.assertEquals(Level2.class.getMethod("m6").invoke(receiver), Integer.valueOf(36));
+		}
+	}
+}
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package jit.test.vich;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import jit.test.vich.utils.Timer;
+
+/**
+ * Times synchronized blocks on objects without a lockword, whose monitors are found through
+ * the VM monitor table. Each thread locks objects picked from a shared set of arrays, so that
+ * lookups miss the per-thread monitor cache and threads contend both on the monitors and on
+ * the monitor table. Checks that no increment made under a monitor is lost.
+ */
+public class MonitorContention {
+
+	private static Logger logger = Logger.getLogger(MonitorContention.class);
+	Timer timer;
+
+	public MonitorContention() {
+		timer = new Timer ();
+	}
+
+	static final int lockCount = 4096;
+	static final int loopCount = 200000;
+	static final int maxThreads = 8;
+
+	private final Object[] locks = new Object[lockCount];
+
+	private void work(int seed) {
+		int next = seed * 7919;
+		for (int i = 0; i < loopCount; i++) {
+			/* simple LCG so that consecutive locks are spread over the whole set */
+			next = (next * 1103515245) + 12345;
+			int[] lock = (int[])locks[(next >>> 1) % locks.length];
+			synchronized (lock) {
+				lock[0] += 1;
+			}
+		}
+	}
+
+	private void runThreads(int threadCount) throws InterruptedException
+	{
+		Thread[] threads = new Thread[threadCount];
+		for (int i = 0; i < threadCount; i++) {
+			final int seed = i;
+			threads[i] = new Thread() {
+				public void run() {
+					work(seed);
+				}
+			};
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].start();
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].join();
+		}
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testMonitorContention() throws InterruptedException
+	{
+		int threadCount = Math.min(Runtime.getRuntime().availableProcessors(), maxThreads);
+		long total = 0;
+
+		for (int i = 0; i < lockCount; i++) {
+			/* arrays never have a lockword */
+			locks[i] = new int[1];
+		}
+
+		/* the first run also inflates the monitors of all the lock objects */
+		timer.reset();
+		runThreads(threadCount);
+		timer.mark();
+		logger.info(threadCount + " threads x " + loopCount + " synchronized blocks on " + lockCount + " objects, first run = " + timer.delta());
+
+		timer.reset();
+		runThreads(threadCount);
+		timer.mark();
+		logger.info(threadCount + " threads x " + loopCount + " synchronized blocks on " + lockCount + " objects = " + timer.delta());
+
+		for (int i = 0; i < lockCount; i++) {
+			total += ((int[])locks[i])[0];
+		}
+		Assert.assertEquals(total, 2L * threadCount * loopCount, "An increment made under a monitor was lost");
+	}
+}
@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package jit.test.vich;
+
+import java.io.ByteArrayOutputStream;
+import java.io.InputStream;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import jit.test.vich.utils.Timer;
+
+/**
+ * Times class definitions made by several threads at once, as parallel capable class
+ * loaders do at startup. Each definition is a copy of a template class in a new class
+ * loader, so that the definitions do not collide on a class name and contend only inside
+ * the VM. Checks that every definition produces its own class in its own loader.
+ */
+public class ParallelDefineClass {
+
+	private static Logger logger = Logger.getLogger(ParallelDefineClass.class);
+	Timer timer;
+
+	public ParallelDefineClass() {
+		timer = new Timer ();
+	}
+
+	static final int loopCount = 500;
+	static final int maxThreads = 8;
+
+	private static final String templateName = Template.class.getName();
+
+	static final class DefiningLoader extends ClassLoader {
+		DefiningLoader(ClassLoader parent) {
+			super(parent);
+		}
+
+		Class<?> define(byte[] bytes) {
+			return defineClass(templateName, bytes, 0, bytes.length);
+		}
+	}
+
+	/* class with enough members that parsing it is a realistic amount of work */
+	static final class Template {
+		private int a, b, c, d;
+		private String s, t;
+		public int sum() { return a + b + c + d; }
+		public int product() { return a * b * c * d; }
+		public String concat() { return s + t; }
+		public boolean same() { return (null != s) && s.equals(t); }
+		public int max() { return Math.max(Math.max(a, b), Math.max(c, d)); }
+		public int min() { return Math.min(Math.min(a, b), Math.min(c, d)); }
+		public void set(int a, int b, int c, int d) { this.a = a; this.b = b; this.c = c; this.d = d; }
+		public void set(String s, String t) { this.s = s; this.t = t; }
+		public String toString() { return "Template[" + sum() + ", " + concat() + "]"; }
+	}
+
+	private static byte[] readTemplate() throws Exception {
+		String resource = templateName.replace('.', '/') + ".class";
+		InputStream in = ParallelDefineClass.class.getClassLoader().getResourceAsStream(resource);
+		try {
+			ByteArrayOutputStream out = new ByteArrayOutputStream();
+			byte[] buffer = new byte[4096];
+			int count = 0;
+			while ((count = in.read(buffer)) > 0) {
+				out.write(buffer, 0, count);
+			}
+			return out.toByteArray();
+		} finally {
+			in.close();
+		}
+	}
+
+	private void runThreads(final byte[] bytes, int threadCount, final boolean[] passed) throws InterruptedException
+	{
+		final ClassLoader parent = ParallelDefineClass.class.getClassLoader();
+		Thread[] threads = new Thread[threadCount];
+		for (int i = 0; i < threadCount; i++) {
+			threads[i] = new Thread() {
+				public void run() {
+					for (int n = 0; n < loopCount; n++) {
+						DefiningLoader loader = new DefiningLoader(parent);
+						Class<?> clazz = loader.define(bytes);
+						if ((clazz.getClassLoader() != loader) || !templateName.equals(clazz.getName())) {
+							passed[0] = false;
+						}
+					}
+				}
+			};
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].start();
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].join();
+		}
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testParallelDefineClass() throws Exception
+	{
+		int threadLimit = Math.min(Runtime.getRuntime().availableProcessors(), maxThreads);
+		byte[] bytes = readTemplate();
+		boolean[] passed = new boolean[] { true };
+
+		for (int threadCount = 1; threadCount <= threadLimit; threadCount *= 2) {
+			timer.reset();
+			runThreads(bytes, threadCount, passed);
+			timer.mark();
+			logger.info(threadCount + " threads x " + loopCount + " defineClass calls = " + timer.delta());
+		}
+		Assert.assertTrue(passed[0], "A class was not defined by its own loader");
+	}
+}
@@ -25,7 +25,10 @@ import org.testng.annotations.Test;
 import org.testng.log4testng.Logger;
 import org.testng.Assert;
 import org.testng.AssertJUnit;
+import java.io.ByteArrayOutputStream;
+import java.io.InputStream;
 import java.lang.reflect.Field;
+import java.lang.reflect.Method;
 
 @Test(groups = { "level.sanity" })
 public class StringInterning {
@@ -209,4 +212,173 @@ public class StringInterning {
 
 	}
 
+	public class internSharedStrings extends Thread {
+		private String[] shared;
+		private String[] canonical;
+		private int iterations;
+		boolean passed;
+
+		public internSharedStrings(String[] shared, String[] canonical, int iterations) {
+			super();
+			this.shared = shared;
+			this.canonical = canonical;
+			this.iterations = iterations;
+		}
+
+		@Override
+		public void run() {
+			passed = true;
+			for (int j = 0; j < iterations; j++) {
+				for (int i = 0; i < shared.length; i++) {
+					/* build a fresh copy each time so that intern() has to find the canonical instance */
+					String temp = new String(shared[i].toCharArray()).intern();
+					passed &= (canonical[i] == temp);
+				}
+			}
+		}
+
+		public boolean isPassed() {
+			return passed;
+		}
+	}
+
+	/**
+	 * Many threads interning the same set of strings must all get the same canonical
+	 * instance. Doubles as a contention microbenchmark for the intern table; the elapsed
+	 * time is reported at debug level.
+	 */
+	public void testConcurrentSharedStringInterning() {
+		final int numThreads = Math.max(4, Runtime.getRuntime().availableProcessors());
+		final int numStrings = 2000;
+		final int iterations = 20;
+		String[] shared = new String[numStrings];
+		String[] canonical = new String[numStrings];
+		internSharedStrings[] threads = new internSharedStrings[numThreads];
+
+		for (int i = 0; i < numStrings; i++) {
+			shared[i] = "sharedIntern" + i;
+			canonical[i] = shared[i].intern();
+		}
+		for (int t = 0; t < numThreads; t++) {
+			threads[t] = new internSharedStrings(shared, canonical, iterations);
+		}
+
+		long start = System.nanoTime();
+		for (int t = 0; t < numThreads; t++) {
+			threads[t].start();
+		}
+		try {
+			for (int t = 0; t < numThreads; t++) {
+				threads[t].join();
+			}
+		} catch (InterruptedException e) {
+			e.printStackTrace();
+			Assert.fail("exception in internSharedStrings");
+		}
+		long elapsed = System.nanoTime() - start;
+		logger.debug("testConcurrentSharedStringInterning: " + numThreads + " threads, "
+				+ ((long)numThreads * numStrings * iterations) + " interns in " + (elapsed / 1000000) + "ms");
+
+		for (int t = 0; t < numThreads; t++) {
+			AssertJUnit.assertTrue(threads[t].isPassed());
+		}
+	}
+
+	/* string constants resolved by each copy of this class are interned from UTF8 data */
+	public static class StringConstants {
+		public static String[] constants() {
+			return new String[] { "utf8ConstantA", "utf8ConstantB", "utf8ConstantC", "utf8Constant\u00e9", "utf8Constant\uc548" };
+		}
+	}
+
+	static class ConstantsLoader extends ClassLoader {
+		ConstantsLoader(ClassLoader parent) {
+			super(parent);
+		}
+
+		Class<?> define(byte[] bytes) {
+			return defineClass(StringConstants.class.getName(), bytes, 0, bytes.length);
+		}
+	}
+
+	public class resolveConstants extends Thread {
+		private byte[] bytes;
+		private String[] canonical;
+		private int iterations;
+		boolean passed;
+
+		public resolveConstants(byte[] bytes, String[] canonical, int iterations) {
+			super();
+			this.bytes = bytes;
+			this.canonical = canonical;
+			this.iterations = iterations;
+		}
+
+		@Override
+		public void run() {
+			passed = true;
+			try {
+				for (int j = 0; j < iterations; j++) {
+					/* a new copy of the class resolves its string constants again */
+					Class<?> clazz = new ConstantsLoader(StringInterning.class.getClassLoader()).define(bytes);
+					Method method = clazz.getMethod("constants");
+					String[] constants = (String[])method.invoke(null);
+					for (int i = 0; i < canonical.length; i++) {
+						passed &= (canonical[i] == constants[i]);
+					}
+				}
+			} catch (Exception e) {
+				e.printStackTrace();
+				passed = false;
+			}
+		}
+
+		public boolean isPassed() {
+			return passed;
+		}
+	}
+
+	/**
+	 * String constants are interned from the UTF8 data in the class rather than through
+	 * String.intern(). Many threads resolving the constants of their own copy of a class
+	 * must all get the canonical instances.
+	 */
+	public void testConcurrentConstantStringResolution() throws Exception {
+		final int numThreads = Math.max(4, Runtime.getRuntime().availableProcessors());
+		final int iterations = 200;
+		String[] canonical = StringConstants.constants();
+		resolveConstants[] threads = new resolveConstants[numThreads];
+		byte[] bytes = null;
+
+		String resource = StringConstants.class.getName().replace('.', '/') + ".class";
+		InputStream in = StringInterning.class.getClassLoader().getResourceAsStream(resource);
+		try {
+			ByteArrayOutputStream out = new ByteArrayOutputStream();
+			byte[] buffer = new byte[4096];
+			int count = 0;
+			while ((count = in.read(buffer)) > 0) {
+				out.write(buffer, 0, count);
+			}
+			bytes = out.toByteArray();
+		} finally {
+			in.close();
+		}
+
+		for (int t = 0; t < numThreads; t++) {
+			threads[t] = new resolveConstants(bytes, canonical, iterations);
+		}
+		for (int t = 0; t < numThreads; t++) {
+			threads[t].start();
+		}
+		for (int t = 0; t < numThreads; t++) {
+			threads[t].join();
+		}
+		for (int t = 0; t < numThreads; t++) {
+			AssertJUnit.assertTrue(threads[t].isPassed());
+		}
+		for (int i = 0; i < canonical.length; i++) {
+			AssertJUnit.assertSame(canonical[i], canonical[i].intern());
+		}
+	}
+
 }
@@ -0,0 +1,44 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package j9vm.test.jni;
+
+/**
+ * Mounts a continuation, pushes a local ref on its stack and unmounts it. The thread must
+ * get back its own stack state, and the ref must stay on the continuation stack.
+ */
+public class ContinuationMountTest {
+	public static void main(String[] args) {
+		try {
+			System.loadLibrary("j9ben");
+			if (!mountAndUnmount(new Object())) {
+				System.out.println("**FAILURE** Mounting and unmounting a continuation did not swap the thread state");
+				throw new RuntimeException();
+			}
+		} catch (UnsatisfiedLinkError e) {
+			System.out.println("Problem opening JNI library");
+			e.printStackTrace();
+			throw new RuntimeException();
+		}
+	}
+
+	public static native boolean mountAndUnmount(Object obj);
+}
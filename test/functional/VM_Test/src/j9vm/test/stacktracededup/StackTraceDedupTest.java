@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package j9vm.test.stacktracededup;
+
+import java.lang.reflect.Field;
+
+import sun.misc.Unsafe;
+
+/**
+ * Runs with -XX:+DeduplicateStackTraces. Exceptions created at the same site must share
+ * their walkback, and exceptions created at other sites, including those whose stack
+ * shape falls in an occupied slot of the deduplication cache, must keep their own trace.
+ */
+public class StackTraceDedupTest {
+	/* More stack shapes than there are slots in the deduplication cache, so that some collide */
+	static final int SHAPES = 600;
+
+	static Unsafe unsafe;
+	static long walkbackOffset;
+
+	static Throwable createAtSiteA() {
+		return new Throwable();
+	}
+
+	static Throwable createAtSiteB() {
+		return new Throwable();
+	}
+
+	static Throwable recurse(int depth) {
+		if (0 == depth) {
+			return new Throwable();
+		}
+		return recurse(depth - 1);
+	}
+
+	static Object walkback(Throwable t) {
+		return unsafe.getObject(t, walkbackOffset);
+	}
+
+	static void check(boolean condition, String message) {
+		if (!condition) {
+			System.out.println("***FAILED*** " + message);
+			throw new RuntimeException(message);
+		}
+	}
+
+	static void checkTopFrame(Throwable t, String methodName) {
+		StackTraceElement[] trace = t.getStackTrace();
+		check(trace.length > 1, "trace too short: " + trace.length);
+		check(methodName.equals(trace[0].getMethodName()), "expected " + methodName + " but found " + trace[0]);
+	}
+
+	public void testSameSite() {
+		Throwable[] throwables = new Throwable[2];
+		for (int i = 0; i < throwables.length; i++) {
+			throwables[i] = createAtSiteA();
+		}
+		check(null != walkback(throwables[0]), "no walkback");
+		check(walkback(throwables[0]) == walkback(throwables[1]), "exceptions from the same site do not share the walkback");
+		checkTopFrame(throwables[0], "createAtSiteA");
+		checkTopFrame(throwables[1], "createAtSiteA");
+		StackTraceElement[] first = throwables[0].getStackTrace();
+		StackTraceElement[] second = throwables[1].getStackTrace();
+		check(first.length == second.length, "traces of the same site differ in length");
+		for (int i = 0; i < first.length; i++) {
+			check(first[i].equals(second[i]), "traces of the same site differ at " + first[i] + " and " + second[i]);
+		}
+
+		Throwable other = createAtSiteB();
+		check(walkback(throwables[0]) != walkback(other), "exceptions from different sites share the walkback");
+		checkTopFrame(other, "createAtSiteB");
+		check(first[1].getLineNumber() != other.getStackTrace()[1].getLineNumber(), "different sites report the same caller line");
+		System.out.println("testSameSite passed");
+	}
+
+	static void checkRecursionTrace(Throwable t, int depth) {
+		StackTraceElement[] trace = t.getStackTrace();
+		int frames = 0;
+		while ((frames < trace.length) && "recurse".equals(trace[frames].getMethodName())) {
+			frames += 1;
+		}
+		check((depth + 1) == frames, "expected " + (depth + 1) + " recurse frames but found " + frames);
+		check("testCollisions".equals(trace[frames].getMethodName()), "expected testCollisions but found " + trace[frames]);
+	}
+
+	public void testCollisions() {
+		Throwable[] throwables = new Throwable[SHAPES];
+		for (int depth = 0; depth < SHAPES; depth++) {
+			throwables[depth] = recurse(depth);
+		}
+		for (int depth = 0; depth < SHAPES; depth++) {
+			Object walkback = walkback(throwables[depth]);
+			for (int other = depth + 1; other < SHAPES; other++) {
+				check(walkback != walkback(throwables[other]), "depths " + depth + " and " + other + " share the walkback");
+			}
+			checkRecursionTrace(throwables[depth], depth);
+		}
+		/* Replaying every shape after the cache has been churned must still produce the right traces */
+		for (int depth = SHAPES - 1; depth >= 0; depth--) {
+			checkRecursionTrace(recurse(depth), depth);
+		}
+		System.out.println("testCollisions passed");
+	}
+
+	public static void main(String[] args) throws Exception {
+		Field field = Unsafe.class.getDeclaredField("theUnsafe");
+		field.setAccessible(true);
+		unsafe = (Unsafe)field.get(null);
+		walkbackOffset = unsafe.objectFieldOffset(Throwable.class.getDeclaredField("walkback"));
+
+		StackTraceDedupTest test = new StackTraceDedupTest();
+		test.testSameSite();
+		test.testCollisions();
+	}
+}